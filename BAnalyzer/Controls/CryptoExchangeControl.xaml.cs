@@ -102,47 +102,40 @@ public partial class CryptoExchangeControl : INotifyPropertyChanged,
         set => SetField(ref _darkMode, value);
     }
 
-    /// <summary>
-    /// Calculates indicators of the corresponding type.
-    /// </summary>
-    private static async Task<int[]> CalculateIndicators(AnalysisIndicatorType type, TimeSeriesAnalyzer.Input[] input, int windowSize)
-    {
-        switch (type)
-        {
-            case AnalysisIndicatorType.None: return [];
-            case AnalysisIndicatorType.Spike: return await TimeSeriesAnalyzer.DetectSpikesAsync(input, windowSize);
-            case AnalysisIndicatorType.Change:
-                return await TimeSeriesAnalyzer.DetectChangePointsAsync(input, windowSize);
-            default: throw new InvalidOperationException("Unknown analysis type");
-        }
-    }
-
     /// <summary>
     /// Analysis settings.
     /// </summary>
     private readonly record struct AnalysisSettings(AnalysisIndicatorType AnalysisIndicator, int AnalysisWindowSize);
 
+    // The displayed series are re-requested on each refresh, so their anomaly detectors are kept
+    // between the refreshes and are fed only with the k-lines added since the previous one.
+    private readonly KLineAnomalyTracker _lowPriceAnomalies = new(x => x.LowPrice);
+    private readonly KLineAnomalyTracker _highPriceAnomalies = new(x => x.HighPrice);
+    private readonly KLineAnomalyTracker _volumeAnomalies = new(x => x.QuoteVolume);
+
     /// <summary>
-    /// Returns price and volume indicators calculated according to the current settings.
+    /// Returns price and volume indicators of the given series calculated according to the current settings.
+    /// Must not be called concurrently (the k-line requests are processed one at a time).
     /// </summary>
-    private static async Task<(IList<int> PriceIndicators, IList<int> VolumeIndicators, int WindowSize)>
-        CalculateIndicatorPoints(IList<KLine> sticks, IList<double> tradeVolumeData, AnalysisSettings settings)
+    private (IList<int> PriceIndicators, IList<int> VolumeIndicators, int WindowSize)
+        CalculateIndicatorPoints(object seriesKey, IList<KLine> sticks, AnalysisSettings settings)
     {
-        var analysisIndicator = settings.AnalysisIndicator;
         var analysisWindowSize = settings.AnalysisWindowSize;
+        AnomalyKind kind;
 
-        var priceDataLow = sticks.Select(x => new TimeSeriesAnalyzer.Input
-            { InData = (float)x.LowPrice }).ToArray();
-
-        var priceDataHigh = sticks.Select(x => new TimeSeriesAnalyzer.Input
-            { InData = (float)x.HighPrice }).ToArray();
+        switch (settings.AnalysisIndicator)
+        {
+            case AnalysisIndicatorType.None: return ([], [], analysisWindowSize);
+            case AnalysisIndicatorType.Spike: kind = AnomalyKind.Spike; break;
+            case AnalysisIndicatorType.Change: kind = AnomalyKind.ChangePoint; break;
+            default: throw new InvalidOperationException("Unknown analysis type");
+        }
 
-        var priceIndicatorsLow = await CalculateIndicators(analysisIndicator, priceDataLow, analysisWindowSize);
-        var priceIndicatorsHigh = await CalculateIndicators(analysisIndicator, priceDataHigh, analysisWindowSize);
+        var now = DateTime.UtcNow;
+        var priceIndicatorsLow = _lowPriceAnomalies.Update(seriesKey, sticks, kind, analysisWindowSize, now);
+        var priceIndicatorsHigh = _highPriceAnomalies.Update(seriesKey, sticks, kind, analysisWindowSize, now);
         var priceIndicators = priceIndicatorsLow.ToHashSet().Concat(priceIndicatorsHigh).ToArray();
-
-        var volumeData = tradeVolumeData.Select(x => new TimeSeriesAnalyzer.Input { InData = (float)x }).ToArray();
-        var volumeIndicators = await CalculateIndicators(analysisIndicator, volumeData, analysisWindowSize);
+        var volumeIndicators = _volumeAnomalies.Update(seriesKey, sticks, kind, analysisWindowSize, now);
 
         return (priceIndicators, volumeIndicators, analysisWindowSize);
     }
@@ -150,7 +143,7 @@ public partial class CryptoExchangeControl : INotifyPropertyChanged,
     /// <summary>
     /// Retrieves the sticks-and-price data for the given time interval.
     /// </summary>
-    private static async Task<ChartData> RetrieveSticks(UpdateRequest request, IClientCached client)
+    private async Task<ChartData> RetrieveSticks(UpdateRequest request, IClientCached client)
     {
         var timeFrame = request.TimeFrame;
         var exchangeDescriptor = request.ExchangeDescriptor;
@@ -170,8 +163,8 @@ public partial class CryptoExchangeControl : INotifyPropertyChanged,
         if (sticks.IsNullOrEmpty())
             return ChartData.CreateInvalid;
 
-        var (priceIndicators, volumeIndicators, windowSize) =
-            await CalculateIndicatorPoints(sticks, ChartData.ToTradeVolumes(sticks), request.AnalysisSettings);
+        var (priceIndicators, volumeIndicators, windowSize) = CalculateIndicatorPoints(
+            (request.ExchangeId, exchangeDescriptor, timeFrame.Discretization), sticks, request.AnalysisSettings);
 
         return new ChartData(sticks, priceIndicators,
             volumeIndicators, windowSize, timeFrame.Duration.TotalDays);
@@ -552,7 +545,13 @@ public partial class CryptoExchangeControl : INotifyPropertyChanged,
     /// <summary>
     /// Disposes resources.
     /// </summary>
-    public void Dispose() { _updateTimer.Stop(); }
+    public void Dispose()
+    {
+        _updateTimer.Stop();
+        _lowPriceAnomalies.Dispose();
+        _highPriceAnomalies.Dispose();
+        _volumeAnomalies.Dispose();
+    }
 
     /// <summary>
     /// Handles selection-changed event for tabs.
@@ -59,6 +59,21 @@ public class AssetTimeView
         lock(this) { return this[granularity]; }
     }
 
+    /// <summary>
+    /// Returns k-lines of the given <paramref name="granularity"/> that cover the given time interval
+    /// aggregated from the cached k-lines of the given finer <paramref name="sourceGranularity"/>
+    /// (see <see cref="BlockGrid.RetrieveRobustThreadSafe"/>) or null if the latter do not cover the interval.
+    /// The last returned k-line might be incomplete.
+    /// </summary>
+    public IList<KLine> RetrieveResampledThreadSafe(TimeGranularity granularity, TimeGranularity sourceGranularity,
+        DateTime timeBegin, DateTime timeEnd, out TimeInterval gapIndicator)
+    {
+        var sourceData = GetGridThreadSafe(sourceGranularity).
+            RetrieveRobustThreadSafe(timeBegin, timeEnd, out gapIndicator);
+
+        return sourceData == null ? null : KLineResampler.Resample(sourceData, granularity);
+    }
+
     /// <summary>
     /// Saves the "view" into the given folder.
     /// </summary>
@@ -70,7 +85,7 @@ public class AssetTimeView
         foreach (var (_, grid) in _grid)
         {
             var subDir = Directory.CreateDirectory(Path.Combine(folderPath, grid.Granularity.Encode()));
-            grid.SaveThreadSafe(subDir.FullName, (blocksSaved, bytesSaved) =>
+            grid.SaveArchiveThreadSafe(subDir.FullName, compress: false, (blocksSaved, bytesSaved) =>
                 progressReporter?.Invoke(totalBlocksSaved + blocksSaved, totalBytesSaved + bytesSaved));
 
             totalBlocksSaved += grid.Blocks.Count;
@@ -97,10 +112,13 @@ public class AssetTimeView
             if (!granularity.IsValid)
                 continue;
 
-            result[granularity] = BlockGrid.Load(granularity, dir,
-                (blocksLoaded, bytesLoaded) =>
-                    progressReporter?.Invoke(totalBlocksLoaded + blocksLoaded,
-                        totalBytesLoaded + bytesLoaded));
+            BlockProgressReportingDelegate gridProgressReporter = (blocksLoaded, bytesLoaded) =>
+                progressReporter?.Invoke(totalBlocksLoaded + blocksLoaded, totalBytesLoaded + bytesLoaded);
+
+            // Caches saved before the archive format was introduced are still loaded.
+            result[granularity] = BlockGrid.HasArchive(dir) ?
+                BlockGrid.LoadArchive(granularity, dir, gridProgressReporter) :
+                BlockGrid.Load(granularity, dir, gridProgressReporter);
 
             totalBlocksLoaded += result[granularity].Blocks.Count;
             totalBytesLoaded += result[granularity].SizeInBytes;
@@ -18,6 +18,7 @@
 using BAnalyzer.Utils;
 using BAnalyzerCore.DataConversionUtils;
 using BAnalyzerCore.DataStructures;
+using BAnalyzerCore.Persistence;
 using BAnalyzerCore.Utils;
 using static BAnalyzerCore.Cache.ProgressReportDelegates;
 
@@ -415,6 +416,74 @@ public class BlockGrid
         }
     }
 
+    /// <summary>
+    /// Name of the file the grid is archived to (see <see cref="SaveArchive"/>).
+    /// </summary>
+    private const string ArchiveFileName = "blocks.kla";
+
+    /// <summary>
+    /// Thread-safe version of <see cref="SaveArchive"/> method.
+    /// </summary>
+    public void SaveArchiveThreadSafe(string folderPath, bool compress, BlockProgressReportingDelegate progressReporter)
+    {
+        _lock.EnterReadLock();
+
+        try
+        {
+            SaveArchive(folderPath, compress, progressReporter);
+        }
+        finally
+        {
+            _lock.ExitReadLock();
+        }
+    }
+
+    /// <summary>
+    /// Saves the "grid" into a single columnar archive file (see <see cref="KLineArchive"/>) in the given folder.
+    /// </summary>
+    public void SaveArchive(string folderPath, bool compress, BlockProgressReportingDelegate progressReporter)
+    {
+        KLineArchive.Write(Path.Combine(folderPath, ArchiveFileName), _blocks, compress);
+        progressReporter?.Invoke(_blocks.Count, SizeInBytes);
+    }
+
+    /// <summary>
+    /// Returns "true" if the given <paramref name="folderPath"/> contains an archive saved by <see cref="SaveArchive"/>.
+    /// </summary>
+    public static bool HasArchive(string folderPath) => File.Exists(Path.Combine(folderPath, ArchiveFileName));
+
+    /// <summary>
+    /// Loads an instance of grid from the archive in the given <paramref name="folderPath"/>
+    /// which was saved there previously by <see cref="SaveArchive"/>.
+    /// The archive is memory-mapped, so each block is materialized straight from the mapped columns.
+    /// </summary>
+    public static BlockGrid LoadArchive(TimeGranularity granularity, string folderPath,
+        BlockProgressReportingDelegate progressReporter)
+    {
+        using var archive = new KLineArchive(Path.Combine(folderPath, ArchiveFileName));
+        var blocks = new List<KLineBlock>(archive.BlockCount);
+        var totalBytesLoaded = 0L;
+
+        for (var blockId = 0; blockId < archive.BlockCount; blockId++)
+        {
+            try
+            {
+                var block = new KLineBlock(granularity, archive.Read(blockId));
+                blocks.Add(block);
+
+                progressReporter?.Invoke(blocks.Count, totalBytesLoaded += block.SizeInBytes);
+            } catch { /*ignore*/ }
+        }
+
+        var chronologicalConsistency = blocks.
+            Zip(blocks.Skip(1), (p, n) => p.End <= n.Begin).All(x => x);
+
+        if (!chronologicalConsistency)
+            throw new InvalidOperationException($"Blocks are not chronologically consistent {folderPath}");
+
+        return new BlockGrid(granularity, blocks);
+    }
+
     /// <summary>
     /// Loads an instance of grid from the data in the given <paramref name="folderPath"/>
     /// which was saved there previously by <see cref="Save"/>.
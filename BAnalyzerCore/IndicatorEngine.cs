@@ -0,0 +1,130 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+using System.Runtime.InteropServices;
+using BAnalyzerCore.DataStructures;
+
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Wrapper of a native engine computing a set of technical indicators of a series of k-lines in a single pass.
+/// The engine keeps the state of the indicators, so the series can be fed incrementally
+/// (e.g., candle by candle as they arrive). An instance is meant to serve a single series (symbol)
+/// and is not thread-safe.
+/// </summary>
+public class IndicatorEngine : IDisposable
+{
+    private IntPtr _enginePtr;
+
+    /// <summary>
+    /// Definitions of the computed indicators (in the order their values are reported).
+    /// </summary>
+    public IReadOnlyList<IndicatorSpec> Indicators { get; }
+
+    /// <summary>
+    /// Number of indicators computed per k-line.
+    /// </summary>
+    public int IndicatorCount => Indicators.Count;
+
+    /// <summary>
+    /// Number of k-lines processed since construction (or the last reset).
+    /// </summary>
+    public long KLineCount => NativeDllWrapper.IndicatorEngineGetKLineCount(_enginePtr);
+
+    /// <summary>
+    /// Constructor.
+    /// </summary>
+    public IndicatorEngine(IReadOnlyList<IndicatorSpec> indicators)
+    {
+        var specs = indicators.ToArray();
+        _enginePtr = NativeDllWrapper.IndicatorEngineConstruct(specs.Length, specs);
+
+        if (_enginePtr == IntPtr.Zero)
+            throw new Exception("Failed to instantiate an indicator engine");
+
+        Indicators = specs;
+    }
+
+    /// <summary>
+    /// Finalizer.
+    /// </summary>
+    ~IndicatorEngine() => Dispose();
+
+    /// <summary>
+    /// Processes the given next k-lines of the series and returns values of the indicators
+    /// in the time-major order (<see cref="IndicatorCount"/> consecutive values per k-line).
+    /// </summary>
+    public double[] Update(KLineColumns kLines)
+    {
+        var result = new double[kLines.Count * IndicatorCount];
+
+        if (kLines.Count == 0)
+            return result;
+
+        if (NativeDllWrapper.IndicatorEngineUpdate(_enginePtr, kLines.Count,
+                in MemoryMarshal.GetArrayDataReference(kLines.HighPrice),
+                in MemoryMarshal.GetArrayDataReference(kLines.LowPrice),
+                in MemoryMarshal.GetArrayDataReference(kLines.ClosePrice),
+                in MemoryMarshal.GetArrayDataReference(kLines.Volume),
+                result.Length, ref MemoryMarshal.GetArrayDataReference(result)) != result.Length)
+            throw new Exception("Failed to compute indicators of the k-lines");
+
+        return result;
+    }
+
+    /// <summary>
+    /// The same as <see cref="Update"/> but runs on the thread pool.
+    /// </summary>
+    public async Task<double[]> UpdateAsync(KLineColumns kLines) => await Task.Run(() => Update(kLines));
+
+    /// <summary>
+    /// Processes the given next k-line of the series and returns values of the indicators at it.
+    /// </summary>
+    public double[] Append(KLine kLine)
+    {
+        var result = new double[IndicatorCount];
+        var (high, low, close, volume) = (kLine.HighPrice, kLine.LowPrice, kLine.ClosePrice, kLine.Volume);
+
+        if (NativeDllWrapper.IndicatorEngineUpdate(_enginePtr, 1, in high, in low, in close, in volume,
+                result.Length, ref MemoryMarshal.GetArrayDataReference(result)) != result.Length)
+            throw new Exception("Failed to compute indicators of the k-line");
+
+        return result;
+    }
+
+    /// <summary>
+    /// Discards the state of all the indicators.
+    /// </summary>
+    public void Reset()
+    {
+        if (!NativeDllWrapper.IndicatorEngineReset(_enginePtr))
+            throw new Exception("Failed to reset the indicator engine");
+    }
+
+    /// <summary>
+    /// Disposes the current instance.
+    /// </summary>
+    public void Dispose()
+    {
+        if (_enginePtr == IntPtr.Zero) return;
+
+        if (!NativeDllWrapper.IndicatorEngineFree(_enginePtr))
+            throw new Exception("Failed to dispose an indicator engine");
+
+        _enginePtr = IntPtr.Zero;
+        GC.SuppressFinalize(this);
+    }
+}
\ No newline at end of file
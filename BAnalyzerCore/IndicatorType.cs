@@ -0,0 +1,58 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Types of technical indicators (values must match the native "IndicatorType").
+/// </summary>
+public enum IndicatorType
+{
+    /// <summary>
+    /// Simple moving average of the close price.
+    /// </summary>
+    Sma = 0,
+
+    /// <summary>
+    /// Exponential moving average of the close price.
+    /// </summary>
+    Ema = 1,
+
+    /// <summary>
+    /// Relative strength index (Wilder's smoothing), in [0, 100].
+    /// </summary>
+    Rsi = 2,
+
+    /// <summary>
+    /// Simple moving average of the close price plus "factor" standard deviations.
+    /// </summary>
+    BollingerUpper = 3,
+
+    /// <summary>
+    /// Simple moving average of the close price minus "factor" standard deviations.
+    /// </summary>
+    BollingerLower = 4,
+
+    /// <summary>
+    /// Volume weighted average of the typical ((high + low + close) / 3) price over a rolling window.
+    /// </summary>
+    Vwap = 5,
+
+    /// <summary>
+    /// Average true range (Wilder's smoothing).
+    /// </summary>
+    Atr = 6,
+}
\ No newline at end of file
@@ -0,0 +1,157 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+using BAnalyzerCore.DataStructures;
+
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Detects anomalies in a displayed k-line series, which is re-requested on each refresh.
+/// The instance keeps a streaming detector between the calls, so each call pushes only the k-lines
+/// added since the previous one. A k-line is pushed once it is closed: the values of an open one still
+/// change, so the open k-line is not judged before it closes.
+/// The detector starts over if the series is replaced (different key or settings) or gets a gap after the
+/// already processed k-lines. Not thread-safe.
+/// </summary>
+/// <param name="selector">Returns the value of the series at the given k-line.</param>
+public class KLineAnomalyTracker(Func<KLine, double> selector) : IDisposable
+{
+    private SeriesAnomalyDetector _detector;
+    private AnomalyKind _kind;
+    private int _historyLength;
+    private double _confidence;
+    private object _seriesKey;
+
+    /// <summary>
+    /// Open time of the first k-line the detector was fed with.
+    /// </summary>
+    private DateTime _firstOpenTime;
+
+    /// <summary>
+    /// Open time of the last k-line the detector was fed with (or "null" if there was no such k-line).
+    /// </summary>
+    private DateTime? _lastOpenTime;
+
+    /// <summary>
+    /// Open times of the detected anomalies in chronological order.
+    /// </summary>
+    private readonly List<DateTime> _anomalyOpenTimes = [];
+
+    /// <summary>
+    /// Returns index of the k-line with the given open time or "-1" if there is no such k-line.
+    /// </summary>
+    private static int FindOpenTime(IList<KLine> sticks, DateTime openTime)
+    {
+        var begin = 0;
+        var end = sticks.Count;
+
+        while (begin < end)
+        {
+            var middle = begin + (end - begin) / 2;
+
+            if (sticks[middle].OpenTime < openTime)
+                begin = middle + 1;
+            else
+                end = middle;
+        }
+
+        return begin < sticks.Count && sticks[begin].OpenTime == openTime ? begin : -1;
+    }
+
+    /// <summary>
+    /// Discards the state of the detector and adjusts it to the given settings.
+    /// </summary>
+    private void Restart(object seriesKey, AnomalyKind kind, int historyLength, double confidence, DateTime firstOpenTime)
+    {
+        if (_detector != null && kind == _kind && historyLength == _historyLength && confidence.Equals(_confidence))
+            _detector.Reset();
+        else
+        {
+            _detector?.Dispose();
+            _detector = new SeriesAnomalyDetector(kind, historyLength, confidence);
+            _kind = kind;
+            _historyLength = historyLength;
+            _confidence = confidence;
+        }
+
+        _seriesKey = seriesKey;
+        _firstOpenTime = firstOpenTime;
+        _lastOpenTime = null;
+        _anomalyOpenTimes.Clear();
+    }
+
+    /// <summary>
+    /// Processes the given series and returns zero-based indices (within <paramref name="sticks"/>) of the anomalous k-lines.
+    /// </summary>
+    /// <param name="seriesKey">Identifies the series (e.g., symbol and granularity); a change of the key restarts the detection.</param>
+    /// <param name="sticks">The series (in chronological order); it is expected to extend the previously processed one.</param>
+    /// <param name="kind">Kind of the anomalies to detect.</param>
+    /// <param name="historyLength">Number of the last values anomalies are judged against.</param>
+    /// <param name="now">The current time; k-lines closing later are not processed.</param>
+    /// <param name="confidence">Confidence (in percents) required to report an anomaly.</param>
+    public int[] Update(object seriesKey, IList<KLine> sticks, AnomalyKind kind, int historyLength, DateTime now,
+        double confidence = 95.0)
+    {
+        if (sticks.Count == 0)
+            return [];
+
+        var beginId = _lastOpenTime.HasValue ? FindOpenTime(sticks, _lastOpenTime.Value) + 1 : 0;
+
+        if (_detector == null || !Equals(seriesKey, _seriesKey) || kind != _kind || historyLength != _historyLength ||
+            !confidence.Equals(_confidence) || sticks[0].OpenTime < _firstOpenTime || beginId == 0 && _lastOpenTime.HasValue)
+        {
+            Restart(seriesKey, kind, historyLength, confidence, sticks[0].OpenTime);
+            beginId = 0;
+        }
+
+        var endId = sticks.Count;
+
+        while (endId > beginId && sticks[endId - 1].CloseTime > now)
+            endId--;
+
+        if (endId > beginId)
+        {
+            var values = new double[endId - beginId];
+
+            for (var itemId = 0; itemId < values.Length; itemId++)
+                values[itemId] = selector(sticks[beginId + itemId]);
+
+            _anomalyOpenTimes.AddRange(_detector.Push(values).Select(x => sticks[beginId + x].OpenTime));
+            _lastOpenTime = sticks[endId - 1].OpenTime;
+        }
+
+        // Anomalies that went out of the series are of no use anymore
+        // (so the series can't be extended backwards without a restart).
+        var outdatedCount = 0;
+
+        while (outdatedCount < _anomalyOpenTimes.Count && _anomalyOpenTimes[outdatedCount] < sticks[0].OpenTime)
+            outdatedCount++;
+
+        _anomalyOpenTimes.RemoveRange(0, outdatedCount);
+        _firstOpenTime = sticks[0].OpenTime;
+
+        return _anomalyOpenTimes.Select(x => FindOpenTime(sticks, x)).Where(x => x >= 0).ToArray();
+    }
+
+    /// <summary>
+    /// Disposes the current instance.
+    /// </summary>
+    public void Dispose()
+    {
+        _detector?.Dispose();
+        _detector = null;
+    }
+}
\ No newline at end of file
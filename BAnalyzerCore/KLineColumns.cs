@@ -0,0 +1,86 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+using BAnalyzerCore.DataStructures;
+
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Column-wise ("structure of arrays") representation of a series of k-lines
+/// in the form the native feature-engineering stage consumes it.
+/// </summary>
+public class KLineColumns
+{
+    /// <summary>
+    /// Constructor.
+    /// </summary>
+    public KLineColumns(IReadOnlyList<KLine> kLines)
+    {
+        Count = kLines.Count;
+        OpenPrice = new double[Count];
+        HighPrice = new double[Count];
+        LowPrice = new double[Count];
+        ClosePrice = new double[Count];
+        Volume = new double[Count];
+        TradeCount = new int[Count];
+
+        for (var itemId = 0; itemId < Count; itemId++)
+        {
+            var kLine = kLines[itemId];
+            OpenPrice[itemId] = kLine.OpenPrice;
+            HighPrice[itemId] = kLine.HighPrice;
+            LowPrice[itemId] = kLine.LowPrice;
+            ClosePrice[itemId] = kLine.ClosePrice;
+            Volume[itemId] = kLine.Volume;
+            TradeCount[itemId] = kLine.TradeCount;
+        }
+    }
+
+    /// <summary>
+    /// Number of k-lines.
+    /// </summary>
+    public int Count { get; }
+
+    /// <summary>
+    /// Open prices.
+    /// </summary>
+    public double[] OpenPrice { get; }
+
+    /// <summary>
+    /// High prices.
+    /// </summary>
+    public double[] HighPrice { get; }
+
+    /// <summary>
+    /// Low prices.
+    /// </summary>
+    public double[] LowPrice { get; }
+
+    /// <summary>
+    /// Close prices.
+    /// </summary>
+    public double[] ClosePrice { get; }
+
+    /// <summary>
+    /// Volumes.
+    /// </summary>
+    public double[] Volume { get; }
+
+    /// <summary>
+    /// Trade counts.
+    /// </summary>
+    public int[] TradeCount { get; }
+}
\ No newline at end of file
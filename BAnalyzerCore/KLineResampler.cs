@@ -0,0 +1,142 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+using System.Runtime.InteropServices;
+using BAnalyzerCore.DataStructures;
+
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Wrapper of a native streaming resampler that aggregates chronologically ordered (fine) k-lines
+/// into k-lines of a coarser granularity. A coarse k-line is reported as complete once a fine k-line
+/// of a later one arrives, while the still-open one is available via <see cref="OpenBar"/>.
+/// Pushing a k-line with the same open time as the last one replaces the latter (live updates).
+/// </summary>
+public class KLineResampler : IDisposable
+{
+    private IntPtr _resamplerPtr;
+
+    /// <summary>
+    /// Granularity of the resulting k-lines.
+    /// </summary>
+    public TimeGranularity Granularity { get; }
+
+    /// <summary>
+    /// Constructor.
+    /// </summary>
+    public KLineResampler(TimeGranularity granularity)
+    {
+        var (spanMs, originMs) = GetAlignment(granularity);
+        _resamplerPtr = NativeDllWrapper.KLineResamplerConstruct(spanMs, originMs);
+
+        if (_resamplerPtr == IntPtr.Zero)
+            throw new Exception("Failed to instantiate a k-line resampler");
+
+        Granularity = granularity;
+    }
+
+    /// <summary>
+    /// Finalizer.
+    /// </summary>
+    ~KLineResampler() => Dispose();
+
+    /// <summary>
+    /// Returns span (in milliseconds) of k-lines of the given <paramref name="granularity"/>
+    /// and a time point (in milliseconds since Unix epoch) at which one of them opens.
+    /// </summary>
+    private static (long SpanMs, long OriginMs) GetAlignment(TimeGranularity granularity)
+    {
+        if (!granularity.IsValid || granularity.IsMonth)
+            throw new ArgumentException("Only granularities of a fixed duration can be resampled to");
+
+        const long msInDay = 24 * 60 * 60 * 1000L;
+        var spanMs = granularity.Seconds * 1000L;
+        // Weekly k-lines open on Mondays, while Unix epoch is a Thursday.
+        var originMs = spanMs == 7 * msInDay ? 4 * msInDay : 0L;
+
+        return (spanMs, originMs);
+    }
+
+    /// <summary>
+    /// Returns k-lines of the given <paramref name="granularity"/> aggregated from the given chronologically
+    /// ordered <paramref name="kLines"/> (of a finer granularity). The last resulting k-line might be incomplete.
+    /// </summary>
+    public static IList<KLine> Resample(IEnumerable<KLine> kLines, TimeGranularity granularity)
+    {
+        var (spanMs, originMs) = GetAlignment(granularity);
+        var items = kLines.Select(x => new PackedKLine(x)).ToArray();
+
+        if (items.Length == 0)
+            return [];
+
+        var output = new PackedKLine[items.Length];
+        var count = NativeDllWrapper.KLineResample(items.Length, in MemoryMarshal.GetArrayDataReference(items),
+            spanMs, originMs, output.Length, ref MemoryMarshal.GetArrayDataReference(output));
+
+        if (count < 0)
+            throw new Exception("Failed to resample k-lines");
+
+        return output.Take(count).Select(x => x.ToKLine()).ToList();
+    }
+
+    /// <summary>
+    /// Processes the given next (fine) k-lines and returns the coarse k-lines completed by them.
+    /// </summary>
+    public IList<KLine> Push(IReadOnlyList<KLine> kLines)
+    {
+        if (kLines.Count == 0)
+            return [];
+
+        var items = kLines.Select(x => new PackedKLine(x)).ToArray();
+        var output = new PackedKLine[items.Length];
+        var count = NativeDllWrapper.KLineResamplerPush(_resamplerPtr, items.Length,
+            in MemoryMarshal.GetArrayDataReference(items), output.Length,
+            ref MemoryMarshal.GetArrayDataReference(output));
+
+        if (count < 0)
+            throw new Exception("Failed to resample k-lines");
+
+        return output.Take(count).Select(x => x.ToKLine()).ToList();
+    }
+
+    /// <summary>
+    /// The still-open coarse k-line or null if there is none.
+    /// </summary>
+    public KLine OpenBar => NativeDllWrapper.KLineResamplerGetOpenBar(_resamplerPtr, out var bar) ? bar.ToKLine() : null;
+
+    /// <summary>
+    /// Discards the open coarse k-line.
+    /// </summary>
+    public void Reset()
+    {
+        if (!NativeDllWrapper.KLineResamplerReset(_resamplerPtr))
+            throw new Exception("Failed to reset the k-line resampler");
+    }
+
+    /// <summary>
+    /// Disposes the current instance.
+    /// </summary>
+    public void Dispose()
+    {
+        if (_resamplerPtr == IntPtr.Zero) return;
+
+        if (!NativeDllWrapper.KLineResamplerFree(_resamplerPtr))
+            throw new Exception("Failed to dispose a k-line resampler");
+
+        _resamplerPtr = IntPtr.Zero;
+        GC.SuppressFinalize(this);
+    }
+}
\ No newline at end of file
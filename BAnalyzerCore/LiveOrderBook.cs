@@ -0,0 +1,209 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using BAnalyzerCore.DataStructures;
+
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Wrapper of a native order book kept up to date with exchange "diff" updates.
+/// Each side is stored natively as flat arrays of prices and quantities sorted from the best price,
+/// so that diffs are merged incrementally and depth snapshots (raw or aggregated into price buckets)
+/// are written directly into the caller's buffers. Not thread safe.
+/// </summary>
+public class LiveOrderBook : IOrderBook, IDisposable
+{
+    private IntPtr _bookPtr;
+
+    /// <summary>
+    /// Constructor.
+    /// </summary>
+    /// <param name="symbol">The symbol of the order book.</param>
+    public LiveOrderBook(string symbol)
+    {
+        Symbol = symbol;
+        _bookPtr = NativeDllWrapper.OrderBookConstruct();
+
+        if (_bookPtr == IntPtr.Zero)
+            throw new Exception("Failed to instantiate an order book");
+    }
+
+    /// <summary>
+    /// Finalizer.
+    /// </summary>
+    ~LiveOrderBook() => Dispose();
+
+    /// <inheritdoc/>
+    public string Symbol { get; }
+
+    /// <inheritdoc/>
+    public IOrderBookEntry[] Bids => GetEntries(OrderBookSide.Bid);
+
+    /// <inheritdoc/>
+    public IOrderBookEntry[] Asks => GetEntries(OrderBookSide.Ask);
+
+    /// <summary>
+    /// Identifier of the last update reflected by the book ("-1" until a snapshot is applied).
+    /// </summary>
+    public long UpdateId => NativeDllWrapper.OrderBookGetUpdateId(_bookPtr);
+
+    /// <summary>
+    /// Returns reference to the first element of the given span or a null reference if the span is empty.
+    /// </summary>
+    private static ref double GetReferenceOrNull(Span<double> span) =>
+        ref span.IsEmpty ? ref Unsafe.NullRef<double>() : ref MemoryMarshal.GetReference(span);
+
+    /// <summary>
+    /// Throws an exception if the given prices and quantities do not describe the same number of levels.
+    /// </summary>
+    private static void CheckLevels(ReadOnlySpan<double> prices, ReadOnlySpan<double> quantities)
+    {
+        if (prices.Length != quantities.Length)
+            throw new ArgumentException("Numbers of prices and quantities must be equal");
+    }
+
+    /// <summary>
+    /// Returns capacity of the given output buffers.
+    /// </summary>
+    private static int GetCapacity(Span<double> prices, Span<double> quantities, Span<double> cumulative)
+    {
+        var capacity = Math.Min(prices.Length, quantities.Length);
+
+        if (!cumulative.IsEmpty && cumulative.Length < capacity)
+            throw new ArgumentException("The buffer of cumulative quantities is too small");
+
+        return capacity;
+    }
+
+    /// <summary>
+    /// Returns all the levels of the given side as order book entries.
+    /// </summary>
+    private IOrderBookEntry[] GetEntries(OrderBookSide side)
+    {
+        var levelCount = GetLevelCount(side);
+        var prices = new double[levelCount];
+        var quantities = new double[levelCount];
+        CopyDepth(side, prices, quantities, Span<double>.Empty);
+
+        return prices.Zip(quantities, (p, q) => (IOrderBookEntry)new OrderBookEntry(p, q)).ToArray();
+    }
+
+    /// <summary>
+    /// Replaces content of the book with the given snapshot (levels may come in any order).
+    /// </summary>
+    public void ApplySnapshot(long updateId, ReadOnlySpan<double> bidPrices, ReadOnlySpan<double> bidQuantities,
+        ReadOnlySpan<double> askPrices, ReadOnlySpan<double> askQuantities)
+    {
+        CheckLevels(bidPrices, bidQuantities);
+        CheckLevels(askPrices, askQuantities);
+
+        if (!NativeDllWrapper.OrderBookApplySnapshot(_bookPtr, updateId,
+                bidPrices.Length, in MemoryMarshal.GetReference(bidPrices), in MemoryMarshal.GetReference(bidQuantities),
+                askPrices.Length, in MemoryMarshal.GetReference(askPrices), in MemoryMarshal.GetReference(askQuantities)))
+            throw new Exception("Failed to apply snapshot of the order book");
+    }
+
+    /// <summary>
+    /// Replaces content of the book with the given snapshot.
+    /// </summary>
+    public void ApplySnapshot(long updateId, IOrderBook snapshot) =>
+        ApplySnapshot(updateId, snapshot.Bids.Select(x => x.Price).ToArray(), snapshot.Bids.Select(x => x.Quantity).ToArray(),
+            snapshot.Asks.Select(x => x.Price).ToArray(), snapshot.Asks.Select(x => x.Quantity).ToArray());
+
+    /// <summary>
+    /// Merges the given diff covering updates from <paramref name="firstUpdateId"/> to <paramref name="lastUpdateId"/>
+    /// into the book (a zero quantity removes the price level).
+    /// </summary>
+    public OrderBookDiffResult ApplyDiff(long firstUpdateId, long lastUpdateId,
+        ReadOnlySpan<double> bidPrices, ReadOnlySpan<double> bidQuantities,
+        ReadOnlySpan<double> askPrices, ReadOnlySpan<double> askQuantities)
+    {
+        CheckLevels(bidPrices, bidQuantities);
+        CheckLevels(askPrices, askQuantities);
+
+        var result = NativeDllWrapper.OrderBookApplyDiff(_bookPtr, firstUpdateId, lastUpdateId,
+            bidPrices.Length, in MemoryMarshal.GetReference(bidPrices), in MemoryMarshal.GetReference(bidQuantities),
+            askPrices.Length, in MemoryMarshal.GetReference(askPrices), in MemoryMarshal.GetReference(askQuantities));
+
+        if (result < 0)
+            throw new Exception("Failed to apply diff to the order book");
+
+        return (OrderBookDiffResult)result;
+    }
+
+    /// <summary>
+    /// Returns number of price levels on the given side of the book.
+    /// </summary>
+    public int GetLevelCount(OrderBookSide side)
+    {
+        var result = NativeDllWrapper.OrderBookGetLevelCount(_bookPtr, side);
+
+        if (result < 0)
+            throw new Exception("Failed to retrieve depth of the order book");
+
+        return result;
+    }
+
+    /// <summary>
+    /// Writes the best levels of the given side into <paramref name="prices"/> and <paramref name="quantities"/>
+    /// and, unless <paramref name="cumulative"/> is empty, running totals of the quantities into <paramref name="cumulative"/>.
+    /// Returns number of the written levels.
+    /// </summary>
+    public int CopyDepth(OrderBookSide side, Span<double> prices, Span<double> quantities, Span<double> cumulative)
+    {
+        var result = NativeDllWrapper.OrderBookGetDepth(_bookPtr, side, GetCapacity(prices, quantities, cumulative),
+            ref MemoryMarshal.GetReference(prices), ref MemoryMarshal.GetReference(quantities), ref GetReferenceOrNull(cumulative));
+
+        if (result < 0)
+            throw new Exception("Failed to copy depth of the order book");
+
+        return result;
+    }
+
+    /// <summary>
+    /// Aggregates levels of the given side into price buckets of the given size (bids are rounded down and asks up
+    /// to a multiple of <paramref name="bucketSize"/>) and writes the best buckets into <paramref name="prices"/>
+    /// and <paramref name="quantities"/> and, unless <paramref name="cumulative"/> is empty, running totals of the
+    /// quantities into <paramref name="cumulative"/>. Returns number of the written buckets.
+    /// </summary>
+    public int Aggregate(OrderBookSide side, double bucketSize, Span<double> prices, Span<double> quantities,
+        Span<double> cumulative)
+    {
+        var result = NativeDllWrapper.OrderBookAggregate(_bookPtr, side, bucketSize, GetCapacity(prices, quantities, cumulative),
+            ref MemoryMarshal.GetReference(prices), ref MemoryMarshal.GetReference(quantities), ref GetReferenceOrNull(cumulative));
+
+        if (result < 0)
+            throw new Exception("Failed to aggregate the order book");
+
+        return result;
+    }
+
+    /// <summary>
+    /// Disposes the current instance.
+    /// </summary>
+    public void Dispose()
+    {
+        if (_bookPtr == IntPtr.Zero) return;
+
+        if (!NativeDllWrapper.OrderBookFree(_bookPtr))
+            throw new Exception("Failed to dispose an order book");
+
+        _bookPtr = IntPtr.Zero;
+        GC.SuppressFinalize(this);
+    }
+}
\ No newline at end of file
@@ -16,6 +16,8 @@
 //SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 using System.Runtime.InteropServices;
+using BAnalyzerCore.DataStructures;
+using BAnalyzerCore.Persistence;
 
 namespace BAnalyzerCore;
 
@@ -32,11 +34,17 @@ internal static class NativeDllWrapper
     /// <param name="layerItemSizesCount">Number of items in <param name="layerItemSizes"/> array.</param>
     /// <param name="layerItemSizes">Contains item sizes for all the layers of the neural
     /// net including the input one (which,technically is not actually present in the neural net).</param>
+    /// <param name="layerActivations">Activation functions of the layers
+    /// (<paramref name="layerItemSizesCount"/> - 1 items) or null if all the layers should use sigmoid.</param>
+    /// <param name="cost">Cost function the net is to be trained with.</param>
     [DllImport("BAnalyzerNativeDll.dll")]
     public static extern IntPtr RnnConstruct(int timeDepth,
         int layerItemSizesCount, 
         [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 1)]
-        int[] layerItemSizes);
+        int[] layerItemSizes,
+        [MarshalAs(UnmanagedType.LPArray)]
+        RnnActivation[] layerActivations,
+        RnnCost cost);
 
     /// <summary>
     /// Returns size of a single input time-point item of the RNN pointed by <paramref name="rnnPtr"/>.
@@ -88,6 +96,82 @@ internal static class NativeDllWrapper
         [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 1)]
         double[] input, GetArrayCallBack getResultCallback);
 
+    /// <summary>
+    /// Evaluates the RNN pointed to by the given <param name="rnnPtr"/> at each of the input items
+    /// packed into the given <param name="inputAggregate"/> and retrieves concatenation of the results in a single callback call.
+    /// Returns "true" in case of success.
+    /// </summary>
+    /// <param name="rnnPtr">Pointer to an RNN.</param>
+    /// <param name="inAggregateSize">Number of elements in <param name="inputAggregate"/>.</param>
+    /// <param name="inputAggregate">Collection of input items packed one after another.</param>
+    /// <param name="getResultCallback">instance of a callback function to retrieve the result.</param>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnEvaluateBatch(IntPtr rnnPtr,
+        int inAggregateSize,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 1)]
+        double[] inputAggregate, GetArrayCallBack getResultCallback);
+
+    /// <summary>
+    /// Evaluates the RNN pointed to by the given <param name="rnnPtr"/> at the given <param name="input"/>
+    /// and writes the result directly into the caller-provided buffer starting at <param name="output"/>.
+    /// Returns number of written elements or "-1" in case of failure.
+    /// </summary>
+    /// <param name="rnnPtr">Pointer to an RNN.</param>
+    /// <param name="size">Number of elements in <param name="input"/>.</param>
+    /// <param name="input">Reference to the first element of the input.</param>
+    /// <param name="outputCapacity">Number of elements available in the output buffer.</param>
+    /// <param name="output">Reference to the first element of the output buffer.</param>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int RnnEvaluateToBuffer(IntPtr rnnPtr,
+        int size, in double input, int outputCapacity, ref double output);
+
+    /// <summary>
+    /// Batch version of <see cref="RnnEvaluateToBuffer"/>.
+    /// Returns number of written elements or "-1" in case of failure.
+    /// </summary>
+    /// <param name="rnnPtr">Pointer to an RNN.</param>
+    /// <param name="inAggregateSize">Number of elements in <param name="inputAggregate"/>.</param>
+    /// <param name="inputAggregate">Reference to the first element of the input items packed one after another.</param>
+    /// <param name="outputCapacity">Number of elements available in the output buffer.</param>
+    /// <param name="outputAggregate">Reference to the first element of the output buffer.</param>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int RnnEvaluateBatchToBuffer(IntPtr rnnPtr,
+        int inAggregateSize, in double inputAggregate, int outputCapacity, ref double outputAggregate);
+
+    /// <summary>
+    /// Single precision version of <see cref="RnnEvaluateBatchToBuffer"/>
+    /// (no conversion takes place if <see cref="IsSinglePrecision"/> returns "true").
+    /// Returns number of written elements or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int RnnEvaluateBatchToBufferSingle(IntPtr rnnPtr,
+        int inAggregateSize, in float inputAggregate, int outputCapacity, ref float outputAggregate);
+
+    /// <summary>
+    /// Returns pointer to an evaluation context acquired from the pool of the RNN pointed by <param name="rnnPtr"/>.
+    /// Returns null pointer if something went wrong.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern IntPtr RnnAcquireContext(IntPtr rnnPtr);
+
+    /// <summary>
+    /// Returns the evaluation context pointed by <param name="contextPtr"/> back to the pool
+    /// of the RNN pointed by <param name="rnnPtr"/>. Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnReleaseContext(IntPtr rnnPtr, IntPtr contextPtr);
+
+    /// <summary>
+    /// The same as <see cref="RnnEvaluateBatchToBuffer"/> but uses the evaluation context
+    /// pointed by <param name="contextPtr"/>.
+    /// Returns number of written elements or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int RnnEvaluateBatchInContext(IntPtr rnnPtr, IntPtr contextPtr,
+        int inAggregateSize, in double inputAggregate, int outputCapacity, ref double outputAggregate);
+
     /// <summary>
     /// Runs a single batch-training iteration on the given input and reference (labels) data.
     /// Returns "true" if succeeded.
@@ -108,6 +192,203 @@ internal static class NativeDllWrapper
         [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 3)]
         double[] referenceAggregate, double learningRate);
 
+    /// <summary>
+    /// Single precision version of <see cref="RnnBatchTrain"/>
+    /// (no conversion takes place if <see cref="IsSinglePrecision"/> returns "true").
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnBatchTrainSingle(IntPtr rnnPtr,
+        int inAggregateSize,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 1)]
+        float[] inputAggregate,
+        int refAggregateSize,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 3)]
+        float[] referenceAggregate, double learningRate);
+
+    /// <summary>
+    /// Runs a multi-epoch training of the RNN pointed by <param name="rnnPtr"/> on the given data set.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    /// <param name="rnnPtr">Pointer to an RNN.</param>
+    /// <param name="inAggregateSize">Number of elements in <param name="inputAggregate"/>.</param>
+    /// <param name="inputAggregate">Collection representing input data to train the neural net on.</param>
+    /// <param name="refAggregateSize">Number of elements in <param name="referenceAggregate"/></param>
+    /// <param name="referenceAggregate">Collection representing "labels" to train the neural net on.</param>
+    /// <param name="options">Parameters of the training.</param>
+    /// <param name="result">Summary of the training.</param>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnFit(IntPtr rnnPtr,
+        int inAggregateSize,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 1)]
+        double[] inputAggregate,
+        int refAggregateSize,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 3)]
+        double[] referenceAggregate, in RnnFitOptions options, out RnnFitResult result);
+
+    /// <summary>
+    /// Runs a single batch-training iteration on all the windows (of the depth of the RNN, starting
+    /// at each <paramref name="stride"/>-th time-point) of the given input and reference series.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnTrainSeries(IntPtr rnnPtr,
+        int seriesSize,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 1)]
+        double[] inputSeries,
+        int refSeriesSize,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 3)]
+        double[] referenceSeries, int stride, double learningRate);
+
+    /// <summary>
+    /// Runs a single batch-training iteration on the sequences of the given lengths stored one after another
+    /// in the given input and reference series (truncated backpropagation through time with the given
+    /// <paramref name="truncationLength"/>). Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnTrainSequences(IntPtr rnnPtr,
+        int sequenceCount,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 1)]
+        int[] sequenceLengths,
+        int seriesSize,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 3)]
+        double[] inputSeries,
+        int refSeriesSize,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 5)]
+        double[] referenceSeries, int truncationLength, double learningRate);
+
+    /// <summary>
+    /// The same as <see cref="RnnFit"/> but the training pairs are the windows (of the depth of the RNN,
+    /// starting at each <paramref name="stride"/>-th time-point) of the given input and reference series.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnFitSeries(IntPtr rnnPtr,
+        int seriesSize,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 1)]
+        double[] inputSeries,
+        int refSeriesSize,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 3)]
+        double[] referenceSeries, int stride, in RnnFitOptions options, out RnnFitResult result);
+
+    /// <summary>
+    /// Delegate to report progress of a native training job (index of the finished epoch and the cost after it).
+    /// </summary>
+    public delegate void EpochCostCallBack(int epochId, double cost);
+
+    /// <summary>
+    /// Starts a multi-epoch training of the RNN pointed by <param name="rnnPtr"/> on a native worker thread
+    /// and returns pointer to the job (to be freed with <see cref="RnnJobFree"/>) or null pointer if something went wrong.
+    /// The training data is copied; the optional <paramref name="epochCallback"/> is called on the worker thread.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern IntPtr RnnTrainAsync(IntPtr rnnPtr,
+        int inAggregateSize,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 1)]
+        double[] inputAggregate,
+        int refAggregateSize,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 3)]
+        double[] referenceAggregate, in RnnFitOptions options, EpochCostCallBack epochCallback);
+
+    /// <summary>
+    /// Requests the job pointed by <paramref name="jobPtr"/> to stop after the mini-batch that is in progress.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnJobCancel(IntPtr jobPtr);
+
+    /// <summary>
+    /// Waits until the job pointed by <paramref name="jobPtr"/> is finished or <paramref name="timeoutMs"/>
+    /// milliseconds elapse (negative value means "no timeout") and returns the status of the job
+    /// (see <see cref="RnnTrainingJobStatus"/>) or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int RnnJobWait(IntPtr jobPtr, int timeoutMs);
+
+    /// <summary>
+    /// Retrieves summary of the training performed by the (finished) job pointed by <paramref name="jobPtr"/>.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnJobGetResult(IntPtr jobPtr, out RnnFitResult result);
+
+    /// <summary>
+    /// Cancels the job pointed by <paramref name="jobPtr"/>, waits until it is finished and frees the job.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnJobFree(IntPtr jobPtr);
+
+    /// <summary>
+    /// Sets number of worker threads to be used by training of the RNN pointed by the given <param name="rnnPtr"/>.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnSetThreadCount(IntPtr rnnPtr, int threadCount);
+
+    /// <summary>
+    /// Returns number of worker threads used by training of the RNN pointed by the given <param name="rnnPtr"/>.
+    /// Returns "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int RnnGetThreadCount(IntPtr rnnPtr);
+
+    /// <summary>
+    /// Sets the optimizer the RNN pointed by the given <param name="rnnPtr"/> is to be trained with.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnSetOptimizer(IntPtr rnnPtr, in RnnOptimizerOptions options);
+
+    /// <summary>
+    /// Retrieves parameters of the optimizer the RNN pointed by the given <param name="rnnPtr"/> is trained with.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnGetOptimizer(IntPtr rnnPtr, out RnnOptimizerOptions options);
+
+    /// <summary>
+    /// Pre-sizes the scratch data of the RNN pointed by the given <param name="rnnPtr"/> for training batches
+    /// of up to <paramref name="maxBatchSize"/> pairs and up to <paramref name="evalContextCount"/> simultaneous evaluations.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnReserveScratch(IntPtr rnnPtr, int maxBatchSize, int evalContextCount);
+
+    /// <summary>
+    /// Returns total size (in bytes) of the scratch tensors held by the RNN pointed by the given <param name="rnnPtr"/>.
+    /// Returns "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern long RnnGetScratchFootprint(IntPtr rnnPtr);
+
+    /// <summary>
+    /// Sets upper bound (in bytes, "0" means "no limit") of the converted training data of a single batch
+    /// of the RNN pointed by the given <param name="rnnPtr"/>. Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnSetScratchLimit(IntPtr rnnPtr, long limitBytes);
+
+    /// <summary>
+    /// Returns upper bound (in bytes, "0" means "no limit") of the converted training data of a single batch
+    /// of the RNN pointed by the given <param name="rnnPtr"/>. Returns "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern long RnnGetScratchLimit(IntPtr rnnPtr);
+
     /// <summary>
     /// Destroys an instance of RNN pointed by the given <param name="rnnPtr"/>.
     /// Returns "true" if succeeded.
@@ -118,6 +399,475 @@ internal static class NativeDllWrapper
     [return: MarshalAs(UnmanagedType.U1)]
     public static extern bool RnnFree(IntPtr rnnPtr);
 
+    /// <summary>
+    /// Saves the RNN pointed by <paramref name="rnnPtr"/> into the file with the given path
+    /// storing the weights with the given precision.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnSave(IntPtr rnnPtr, [MarshalAs(UnmanagedType.LPWStr)] string filePath,
+        RnnWeightPrecision weightPrecision);
+
+    /// <summary>
+    /// Returns pointer to an RNN loaded from the file with the given path
+    /// or "zero" pointer in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern IntPtr RnnLoad([MarshalAs(UnmanagedType.LPWStr)] string filePath);
+
+    /// <summary>
+    /// Releases the training data of the RNN pointed by <paramref name="rnnPtr"/> turning it into an inference-only one.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnFreeze(IntPtr rnnPtr);
+
+    /// <summary>
+    /// Returns "true" if the RNN pointed by <paramref name="rnnPtr"/> is inference-only.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnIsFrozen(IntPtr rnnPtr);
+
+    /// <summary>
+    /// Returns pointer to an evaluation stream of the RNN pointed by the given <param name="rnnPtr"/>.
+    /// Returns null pointer if something went wrong.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern IntPtr RnnStreamOpen(IntPtr rnnPtr);
+
+    /// <summary>
+    /// Pushes the given time-point <param name="item"/> into the stream pointed by <param name="streamPtr"/>
+    /// and writes output of the RNN at the latest time-point into the caller-provided buffer.
+    /// Returns number of written elements ("0" until the stream accumulates "depth" items)
+    /// or "-1" in case of failure.
+    /// </summary>
+    /// <param name="streamPtr">Pointer to an RNN stream.</param>
+    /// <param name="itemSize">Number of elements in <param name="item"/>.</param>
+    /// <param name="item">Reference to the first element of the input item.</param>
+    /// <param name="outputCapacity">Number of elements available in the output buffer.</param>
+    /// <param name="output">Reference to the first element of the output buffer.</param>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int RnnStreamPush(IntPtr streamPtr,
+        int itemSize, in double item, int outputCapacity, ref double output);
+
+    /// <summary>
+    /// Discards all the items pushed into the stream pointed by the given <param name="streamPtr"/>.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnStreamReset(IntPtr streamPtr);
+
+    /// <summary>
+    /// Destroys an RNN stream pointed by the given <param name="streamPtr"/>.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnStreamClose(IntPtr streamPtr);
+
+    /// <summary>
+    /// Returns pointer to a set of <paramref name="streamCount"/> evaluation streams of the RNN pointed
+    /// by the given <param name="rnnPtr"/> which are advanced in lockstep.
+    /// Returns null pointer if something went wrong.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern IntPtr RnnMultiStreamOpen(IntPtr rnnPtr, int streamCount);
+
+    /// <summary>
+    /// Appends a time-point item to each stream of the multi-stream pointed by the given <param name="multiStreamPtr"/>.
+    /// Returns number of streams with complete windows or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int RnnMultiStreamPushAll(IntPtr multiStreamPtr, int aggregateSize, in double items);
+
+    /// <summary>
+    /// Writes outputs corresponding to the latest time-point of each stream of the multi-stream pointed by the given
+    /// <param name="multiStreamPtr"/> into <paramref name="output"/>.
+    /// Returns number of written elements ("0" if the windows are not complete yet) or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int RnnMultiStreamReadAll(IntPtr multiStreamPtr, int outputCapacity, ref double output);
+
+    /// <summary>
+    /// Discards all the items pushed into the multi-stream pointed by the given <param name="multiStreamPtr"/>.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnMultiStreamReset(IntPtr multiStreamPtr);
+
+    /// <summary>
+    /// Destroys a multi-stream pointed by the given <param name="multiStreamPtr"/>.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnMultiStreamClose(IntPtr multiStreamPtr);
+
+    /// <summary>
+    /// Trains the given candidate RNNs (item sizes of the layers of all the candidates one after another in
+    /// <paramref name="layerItemSizes"/>, <paramref name="layerCounts"/> per candidate) concurrently on the windows of
+    /// the given series and ranks them by the best validation cost. Pointers to the trained RNNs are written into
+    /// <paramref name="netPtrs"/> in the order of the candidates and the ranked results into <paramref name="results"/>.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnSweep(int candidateCount,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 0)]
+        int[] timeDepths,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 0)]
+        int[] layerCounts,
+        [MarshalAs(UnmanagedType.LPArray)]
+        int[] layerItemSizes,
+        [MarshalAs(UnmanagedType.LPArray)]
+        RnnActivation[] layerActivations,
+        RnnCost cost,
+        int seriesSize,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 6)]
+        double[] inputSeries,
+        int refSeriesSize,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 8)]
+        double[] referenceSeries,
+        int stride, in RnnFitOptions options, int threadCount,
+        [Out, MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 0)]
+        IntPtr[] netPtrs,
+        [Out, MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 0)]
+        RnnSweepOutcome[] results);
+
+    /// <summary>
+    /// Returns pointer to an ensemble of the RNNs pointed by <paramref name="memberPtrs"/> whose outputs are averaged
+    /// with the given <paramref name="weights"/> (null means equal weights).
+    /// Returns null pointer if something went wrong.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern IntPtr RnnEnsembleConstruct(int memberCount,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 0)]
+        IntPtr[] memberPtrs,
+        [MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 0)]
+        double[] weights);
+
+    /// <summary>
+    /// Evaluates the members of the ensemble pointed by <paramref name="ensemblePtr"/> at the given input and writes
+    /// the weighted average of their latest output items into <paramref name="output"/> and (if
+    /// <paramref name="memberOutputCapacity"/> is positive) the latest output items of the members themselves.
+    /// Returns number of elements written into <paramref name="output"/> or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int RnnEnsembleEvaluate(IntPtr ensemblePtr, int size, in double input,
+        int outputCapacity, ref double output, int memberOutputCapacity, ref double memberOutputs);
+
+    /// <summary>
+    /// Returns number of time-point items the input of the ensemble pointed by <paramref name="ensemblePtr"/>
+    /// must consist of or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int RnnEnsembleGetDepth(IntPtr ensemblePtr);
+
+    /// <summary>
+    /// Frees the ensemble pointed by <paramref name="ensemblePtr"/>.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnEnsembleFree(IntPtr ensemblePtr);
+
+    /// <summary>
+    /// Returns pointer to a native streaming detector of anomalies of the given kind in a series of values
+    /// or null pointer if something went wrong.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern IntPtr AnomalyDetectorConstruct(AnomalyKind kind, int historyLength, double confidence);
+
+    /// <summary>
+    /// Processes the given next values of the series of the detector pointed by <paramref name="detectorPtr"/>
+    /// and writes zero-based indices (within the given values) of the anomalous ones into <paramref name="anomalyIds"/>.
+    /// Returns number of the written indices or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int AnomalyDetectorPush(IntPtr detectorPtr, int count, in double values,
+        int capacity, ref int anomalyIds);
+
+    /// <summary>
+    /// Discards the history of the series of the detector pointed by <paramref name="detectorPtr"/>.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool AnomalyDetectorReset(IntPtr detectorPtr);
+
+    /// <summary>
+    /// Frees the detector pointed by <paramref name="detectorPtr"/>.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool AnomalyDetectorFree(IntPtr detectorPtr);
+
+    /// <summary>
+    /// Returns a pointer to a native engine computing the given technical indicators of a series of k-lines.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern IntPtr IndicatorEngineConstruct(int specCount, IndicatorSpec[] specs);
+
+    /// <summary>
+    /// Processes the given next k-lines of the series (passed column-wise)
+    /// and writes values of the indicators into <paramref name="output"/> in the time-major order.
+    /// Returns number of written elements or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int IndicatorEngineUpdate(IntPtr enginePtr, int kLineCount,
+        in double highPrice, in double lowPrice, in double closePrice, in double volume,
+        int outputCapacity, ref double output);
+
+    /// <summary>
+    /// Returns number of k-lines processed by the engine pointed by <paramref name="enginePtr"/>
+    /// or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern long IndicatorEngineGetKLineCount(IntPtr enginePtr);
+
+    /// <summary>
+    /// Discards the state of the indicators of the engine pointed by <paramref name="enginePtr"/>.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool IndicatorEngineReset(IntPtr enginePtr);
+
+    /// <summary>
+    /// Frees the indicator engine pointed by <paramref name="enginePtr"/>.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool IndicatorEngineFree(IntPtr enginePtr);
+
+    /// <summary>
+    /// Aggregates the given chronologically ordered k-lines into k-lines of the given span
+    /// aligned to "originMs + n * spanMs" time points and writes them (including the last incomplete one)
+    /// into <paramref name="output"/>. Returns number of written k-lines or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int KLineResample(int count, in PackedKLine items, long spanMs, long originMs,
+        int outputCapacity, ref PackedKLine output);
+
+    /// <summary>
+    /// Returns a pointer to a native streaming resampler of k-lines to the given span
+    /// aligned to "originMs + n * spanMs" time points.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern IntPtr KLineResamplerConstruct(long spanMs, long originMs);
+
+    /// <summary>
+    /// Processes the given next k-lines and writes the coarse k-lines completed by them into <paramref name="output"/>.
+    /// Returns number of written k-lines or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int KLineResamplerPush(IntPtr resamplerPtr, int count, in PackedKLine items,
+        int outputCapacity, ref PackedKLine output);
+
+    /// <summary>
+    /// Writes the still-open coarse k-line of the resampler pointed by <paramref name="resamplerPtr"/>
+    /// into <paramref name="bar"/>. Returns "true" if there is an open k-line.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool KLineResamplerGetOpenBar(IntPtr resamplerPtr, out PackedKLine bar);
+
+    /// <summary>
+    /// Discards the open coarse k-line of the resampler pointed by <paramref name="resamplerPtr"/>.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool KLineResamplerReset(IntPtr resamplerPtr);
+
+    /// <summary>
+    /// Frees the resampler pointed by <paramref name="resamplerPtr"/>.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool KLineResamplerFree(IntPtr resamplerPtr);
+
+    /// <summary>
+    /// Writes the given chronologically ordered k-lines split into blocks of the given sizes
+    /// into a columnar archive file. Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool KLineArchiveWrite([MarshalAs(UnmanagedType.LPWStr)] string filePath, int blockCount,
+        int[] blockSizes, PackedKLine[] items, [MarshalAs(UnmanagedType.U1)] bool compress);
+
+    /// <summary>
+    /// Returns a pointer to a native archive of k-lines mapped from the given file.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern IntPtr KLineArchiveOpen([MarshalAs(UnmanagedType.LPWStr)] string filePath);
+
+    /// <summary>
+    /// Returns number of blocks in the archive pointed by <paramref name="archivePtr"/> or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int KLineArchiveGetBlockCount(IntPtr archivePtr);
+
+    /// <summary>
+    /// Writes summary of the given block of the archive pointed by <paramref name="archivePtr"/>
+    /// into <paramref name="info"/>. Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool KLineArchiveGetBlockInfo(IntPtr archivePtr, int blockId, out KLineArchiveBlockInfo info);
+
+    /// <summary>
+    /// Writes the given range of k-lines of the given block of the archive pointed by <paramref name="archivePtr"/>
+    /// into <paramref name="output"/>. Returns number of written k-lines or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int KLineArchiveRead(IntPtr archivePtr, int blockId, int beginKLineId, int count,
+        ref PackedKLine output);
+
+    /// <summary>
+    /// Frees the archive pointed by <paramref name="archivePtr"/>.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool KLineArchiveFree(IntPtr archivePtr);
+
+    /// <summary>
+    /// Returns a pointer to an empty native order book kept up to date with diff updates
+    /// or null pointer if something went wrong.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern IntPtr OrderBookConstruct();
+
+    /// <summary>
+    /// Replaces content of the order book pointed by <paramref name="bookPtr"/> with the given snapshot.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool OrderBookApplySnapshot(IntPtr bookPtr, long updateId,
+        int bidCount, in double bidPrices, in double bidQuantities,
+        int askCount, in double askPrices, in double askQuantities);
+
+    /// <summary>
+    /// Merges the given diff covering updates from <paramref name="firstUpdateId"/> to <paramref name="lastUpdateId"/>
+    /// into the order book pointed by <paramref name="bookPtr"/> (a zero quantity removes the price level).
+    /// Returns <see cref="OrderBookDiffResult"/> value or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int OrderBookApplyDiff(IntPtr bookPtr, long firstUpdateId, long lastUpdateId,
+        int bidCount, in double bidPrices, in double bidQuantities,
+        int askCount, in double askPrices, in double askQuantities);
+
+    /// <summary>
+    /// Returns identifier of the last update reflected by the order book pointed by <paramref name="bookPtr"/>
+    /// or "-1" if no snapshot was applied yet or in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern long OrderBookGetUpdateId(IntPtr bookPtr);
+
+    /// <summary>
+    /// Returns number of price levels on the given side of the order book pointed by <paramref name="bookPtr"/>
+    /// or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int OrderBookGetLevelCount(IntPtr bookPtr, OrderBookSide side);
+
+    /// <summary>
+    /// Writes the best levels of the given side of the order book pointed by <paramref name="bookPtr"/> into
+    /// <paramref name="prices"/> and <paramref name="quantities"/> and, unless <paramref name="cumulative"/>
+    /// is a null reference, running totals of the quantities into <paramref name="cumulative"/>.
+    /// Returns number of the written levels or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int OrderBookGetDepth(IntPtr bookPtr, OrderBookSide side, int capacity,
+        ref double prices, ref double quantities, ref double cumulative);
+
+    /// <summary>
+    /// Writes the best price buckets of the given size of the given side of the order book pointed by
+    /// <paramref name="bookPtr"/> into <paramref name="prices"/> and <paramref name="quantities"/> and, unless
+    /// <paramref name="cumulative"/> is a null reference, running totals of the quantities into <paramref name="cumulative"/>.
+    /// Returns number of the written buckets or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int OrderBookAggregate(IntPtr bookPtr, OrderBookSide side, double bucketSize, int capacity,
+        ref double prices, ref double quantities, ref double cumulative);
+
+    /// <summary>
+    /// Frees the order book pointed by <paramref name="bookPtr"/>.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool OrderBookFree(IntPtr bookPtr);
+
+    /// <summary>
+    /// Evaluates the RNN pointed by <paramref name="rnnPtr"/> at each sliding window of the features of the k-lines
+    /// of the given block of the archive pointed by <paramref name="archivePtr"/> and writes the concatenated results
+    /// into <paramref name="output"/>. Returns number of written elements or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int RnnEvaluateArchiveBlock(IntPtr rnnPtr, IntPtr archivePtr, int blockId,
+        int normalizationWindow, int outputCapacity, ref double output);
+
+    /// <summary>
+    /// Returns number of features the native feature-engineering stage computes per k-line.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int KLineFeatureCount();
+
+    /// <summary>
+    /// Evaluates the RNN pointed by <paramref name="rnnPtr"/> at each sliding window of the features
+    /// of the given k-lines (passed column-wise) and writes the concatenated results into <paramref name="output"/>.
+    /// Returns number of written elements or "-1" in case of failure.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    public static extern int RnnEvaluateKLines(IntPtr rnnPtr, int kLineCount,
+        double[] openPrice, double[] highPrice, double[] lowPrice, double[] closePrice,
+        double[] volume, int[] tradeCount, int normalizationWindow, int outputCapacity, ref double output);
+
+    /// <summary>
+    /// Performs a training iteration of the RNN pointed by <paramref name="rnnPtr"/> on all the sliding
+    /// windows of the features of the given k-lines (passed column-wise).
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnTrainKLines(IntPtr rnnPtr, int kLineCount,
+        double[] openPrice, double[] highPrice, double[] lowPrice, double[] closePrice,
+        double[] volume, int[] tradeCount, int normalizationWindow, double learningRate);
+
+    /// <summary>
+    /// Writes snapshot of the hot-path counters of the RNN pointed by the given <param name="rnnPtr"/>
+    /// into <paramref name="stats"/>. Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnGetStats(IntPtr rnnPtr, out RnnStats stats);
+
+    /// <summary>
+    /// Sets all the hot-path counters of the RNN pointed by the given <param name="rnnPtr"/> to zero.
+    /// Returns "true" if succeeded.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool RnnResetStats(IntPtr rnnPtr);
+
+    /// <summary>
+    /// Returns "true" if the DLL is compiled with the hot-path instrumentation on.
+    /// </summary>
+    [DllImport("BAnalyzerNativeDll.dll")]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool IsInstrumentationEnabled();
+
     /// <summary>
     /// Returns "true" if the DLL is compiled against "single" precision arithmetics.
     /// </summary>
@@ -0,0 +1,39 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Outcomes of applying a diff update to an order book (values must match the native "OrderBookDiffResult").
+/// </summary>
+public enum OrderBookDiffResult
+{
+    /// <summary>
+    /// The diff was merged into the book.
+    /// </summary>
+    Applied = 0,
+
+    /// <summary>
+    /// The diff is already covered by the book and was ignored.
+    /// </summary>
+    Stale = 1,
+
+    /// <summary>
+    /// Some updates preceding the diff are missing (or no snapshot was applied yet);
+    /// the book is left intact and must be re-synchronized with a snapshot.
+    /// </summary>
+    Gap = 2,
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+using System.Runtime.InteropServices;
+using BAnalyzerCore.Cache;
+using BAnalyzerCore.DataStructures;
+
+namespace BAnalyzerCore.Persistence;
+
+/// <summary>
+/// Wrapper of a native read-only archive of blocks of k-lines stored column-wise in a memory-mapped file.
+/// Blocks (or ranges of them) are read on demand, so opening an archive costs next to nothing
+/// regardless of its size. Columns of the un-compressed archives are consumed by the native feature-engineering
+/// stage in place (see <see cref="Rnn.EvaluateKLines(KLineArchive, int, int)"/>).
+/// </summary>
+public class KLineArchive : IDisposable
+{
+    private IntPtr _archivePtr;
+
+    /// <summary>
+    /// Pointer to the native archive.
+    /// </summary>
+    internal IntPtr Ptr => _archivePtr;
+
+    /// <summary>
+    /// Constructor. Maps the archive from the given file.
+    /// </summary>
+    public KLineArchive(string filePath)
+    {
+        _archivePtr = NativeDllWrapper.KLineArchiveOpen(filePath);
+
+        if (_archivePtr == IntPtr.Zero)
+            throw new Exception($"Failed to open archive {filePath}");
+
+        BlockCount = NativeDllWrapper.KLineArchiveGetBlockCount(_archivePtr);
+    }
+
+    /// <summary>
+    /// Finalizer.
+    /// </summary>
+    ~KLineArchive() => Dispose();
+
+    /// <summary>
+    /// Writes the given chronologically ordered <paramref name="blocks"/> into an archive file.
+    /// </summary>
+    /// <param name="filePath">Path to the file to write.</param>
+    /// <param name="blocks">Blocks to write.</param>
+    /// <param name="compress">If "true" the time-stamps and values get compressed
+    /// (the blocks are then decoded on their first access).</param>
+    public static void Write(string filePath, IReadOnlyList<IKLineBlockReadOnly> blocks, bool compress)
+    {
+        var blockSizes = blocks.Select(x => x.KlineCount).ToArray();
+        var items = blocks.SelectMany(x => x.Data).Select(x => new PackedKLine(x)).ToArray();
+
+        if (!NativeDllWrapper.KLineArchiveWrite(filePath, blockSizes.Length, blockSizes, items, compress))
+            throw new Exception($"Failed to write archive {filePath}");
+    }
+
+    /// <summary>
+    /// Number of blocks in the archive.
+    /// </summary>
+    public int BlockCount { get; }
+
+    /// <summary>
+    /// Returns summary of the given block.
+    /// </summary>
+    public KLineArchiveBlockInfo GetBlockInfo(int blockId)
+    {
+        if (!NativeDllWrapper.KLineArchiveGetBlockInfo(_archivePtr, blockId, out var info))
+            throw new Exception("Failed to retrieve summary of the block");
+
+        return info;
+    }
+
+    /// <summary>
+    /// Returns <paramref name="count"/> k-lines of the given block starting from
+    /// the one with index <paramref name="beginKLineId"/> (the range is clamped to the size of the block).
+    /// </summary>
+    public KLine[] Read(int blockId, int beginKLineId, int count)
+    {
+        var items = new PackedKLine[Math.Max(count, 0)];
+        var readCount = NativeDllWrapper.KLineArchiveRead(_archivePtr, blockId, beginKLineId, items.Length,
+            ref MemoryMarshal.GetArrayDataReference(items));
+
+        if (readCount < 0)
+            throw new Exception("Failed to read k-lines from the archive");
+
+        var result = new KLine[readCount];
+
+        for (var itemId = 0; itemId < readCount; itemId++)
+            result[itemId] = items[itemId].ToKLine();
+
+        return result;
+    }
+
+    /// <summary>
+    /// Returns all the k-lines of the given block.
+    /// </summary>
+    public KLine[] Read(int blockId) => Read(blockId, 0, GetBlockInfo(blockId).KLineCount);
+
+    /// <summary>
+    /// Disposes the current instance.
+    /// </summary>
+    public void Dispose()
+    {
+        if (_archivePtr == IntPtr.Zero) return;
+
+        if (!NativeDllWrapper.KLineArchiveFree(_archivePtr))
+            throw new Exception("Failed to dispose an archive");
+
+        _archivePtr = IntPtr.Zero;
+        GC.SuppressFinalize(this);
+    }
+}
\ No newline at end of file
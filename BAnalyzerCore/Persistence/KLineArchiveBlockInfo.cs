@@ -0,0 +1,48 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+using System.Runtime.InteropServices;
+using BAnalyzerCore.DataStructures;
+
+namespace BAnalyzerCore.Persistence;
+
+/// <summary>
+/// Summary of a block of <see cref="KLineArchive"/>.
+/// The layout must match the one of the native "ArchiveBlockInfo" structure.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public readonly struct KLineArchiveBlockInfo
+{
+    private readonly long _openTime;
+    private readonly long _closeTime;
+    private readonly int _kLineCount;
+    private readonly int _reserved;
+
+    /// <summary>
+    /// Open time of the first k-line of the block.
+    /// </summary>
+    public DateTime OpenTime => PackedKLine.FromUnixMilliseconds(_openTime);
+
+    /// <summary>
+    /// Close time of the last k-line of the block.
+    /// </summary>
+    public DateTime CloseTime => PackedKLine.FromUnixMilliseconds(_closeTime);
+
+    /// <summary>
+    /// Number of k-lines in the block.
+    /// </summary>
+    public int KLineCount => _kLineCount;
+}
\ No newline at end of file
@@ -15,6 +15,9 @@
 //OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
 //SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
+using System.Runtime.InteropServices;
+using BAnalyzerCore.Persistence;
+
 namespace BAnalyzerCore;
 
 /// <summary>
@@ -27,19 +30,77 @@ public class Rnn : IDisposable
     /// <summary>
     /// Constructor.
     /// </summary>
-    public Rnn(int timeDepth, int[] layerItemSizes)
+    /// <param name="timeDepth">Recursion depth of the net.</param>
+    /// <param name="layerItemSizes">Item sizes of all the layers including the input one.</param>
+    /// <param name="layerActivations">Activation functions of the layers (one less than the number of
+    /// item sizes) or null if all the layers should use sigmoid.</param>
+    /// <param name="cost">Cost function the net is to be trained with.</param>
+    public Rnn(int timeDepth, int[] layerItemSizes, RnnActivation[] layerActivations = null,
+        RnnCost cost = RnnCost.CrossEntropy)
     {
-        _rnnPtr = NativeDllWrapper.RnnConstruct(timeDepth, layerItemSizes.Length, layerItemSizes);
+        if (layerActivations != null && layerActivations.Length != layerItemSizes.Length - 1)
+            throw new Exception("Invalid number of activation functions");
+
+        _rnnPtr = NativeDllWrapper.RnnConstruct(timeDepth, layerItemSizes.Length, layerItemSizes,
+            layerActivations, cost);
 
         if (_rnnPtr == IntPtr.Zero)
             throw new Exception("Failed to instantiate an RNN");
     }
 
+    /// <summary>
+    /// Constructor from the given pointer to a native RNN (takes ownership).
+    /// </summary>
+    internal Rnn(IntPtr rnnPtr) => _rnnPtr = rnnPtr;
+
+    /// <summary>
+    /// Returns an RNN loaded from the given file (see <see cref="Save"/>).
+    /// </summary>
+    public static Rnn Load(string filePath)
+    {
+        var rnnPtr = NativeDllWrapper.RnnLoad(filePath);
+
+        if (rnnPtr == IntPtr.Zero)
+            throw new Exception($"Failed to load an RNN from {filePath}");
+
+        return new Rnn(rnnPtr);
+    }
+
+    /// <summary>
+    /// Saves the RNN into the given file. With reduced <paramref name="precision"/> of the weights
+    /// the file is smaller only: the RNN loaded from it keeps, evaluates and trains full precision weights.
+    /// </summary>
+    public void Save(string filePath, RnnWeightPrecision precision = RnnWeightPrecision.Full)
+    {
+        if (!NativeDllWrapper.RnnSave(_rnnPtr, filePath, precision))
+            throw new Exception($"Failed to save the RNN to {filePath}");
+    }
+
+    /// <summary>
+    /// Releases the native training data of the RNN turning it into an inference-only one
+    /// (training calls fail afterwards).
+    /// </summary>
+    public void Freeze()
+    {
+        if (!NativeDllWrapper.RnnFreeze(_rnnPtr))
+            throw new Exception("Failed to freeze the RNN");
+    }
+
+    /// <summary>
+    /// Returns "true" if the RNN is inference-only (see <see cref="Freeze"/>).
+    /// </summary>
+    public bool IsFrozen => NativeDllWrapper.RnnIsFrozen(_rnnPtr);
+
     /// <summary>
     /// Finalizer.
     /// </summary>
     ~Rnn() => Dispose();
 
+    /// <summary>
+    /// Pointer to the underlying native RNN.
+    /// </summary>
+    internal IntPtr Ptr => _rnnPtr;
+
     /// <summary>
     /// Returns size of an input item of the RNN.
     /// </summary>
@@ -60,6 +121,69 @@ public class Rnn : IDisposable
     /// </summary>
     public int Depth => NativeDllWrapper.RnnGetDepth(_rnnPtr);
 
+    /// <summary>
+    /// Number of worker threads used by training ("1" means sequential training).
+    /// </summary>
+    public int ThreadCount
+    {
+        get => NativeDllWrapper.RnnGetThreadCount(_rnnPtr);
+        set
+        {
+            if (!NativeDllWrapper.RnnSetThreadCount(_rnnPtr, value))
+                throw new Exception("Failed to set number of training threads");
+        }
+    }
+
+    /// <summary>
+    /// Optimizer (and number of gradient accumulation steps) the RNN is trained with by all the training methods.
+    /// Setting it discards state of the previous optimizer (the state is not saved with the RNN either).
+    /// </summary>
+    public RnnOptimizerOptions Optimizer
+    {
+        get
+        {
+            if (!NativeDllWrapper.RnnGetOptimizer(_rnnPtr, out var options))
+                throw new Exception("Failed to retrieve the optimizer of the RNN");
+
+            return options;
+        }
+        set
+        {
+            if (!NativeDllWrapper.RnnSetOptimizer(_rnnPtr, value))
+                throw new Exception("Failed to set the optimizer of the RNN");
+        }
+    }
+
+    /// <summary>
+    /// Pre-sizes the native scratch data so that training with batches of up to <paramref name="maxBatchSize"/>
+    /// pairs and up to <paramref name="evaluationContextCount"/> simultaneous evaluations do not need to reallocate it.
+    /// The layers of the RNN still allocate their temporaries natively, so training and evaluation are not allocation-free.
+    /// </summary>
+    public void ReserveScratch(int maxBatchSize, int evaluationContextCount)
+    {
+        if (!NativeDllWrapper.RnnReserveScratch(_rnnPtr, maxBatchSize, evaluationContextCount))
+            throw new Exception("Failed to reserve scratch data of the RNN");
+    }
+
+    /// <summary>
+    /// Total size (in bytes) of the scratch tensors held by the native RNN.
+    /// </summary>
+    public long ScratchFootprint => NativeDllWrapper.RnnGetScratchFootprint(_rnnPtr);
+
+    /// <summary>
+    /// Upper bound (in bytes) of the converted training data of a single batch ("0" means "no limit").
+    /// Training calls exceeding the limit fail.
+    /// </summary>
+    public long ScratchLimit
+    {
+        get => NativeDllWrapper.RnnGetScratchLimit(_rnnPtr);
+        set
+        {
+            if (!NativeDllWrapper.RnnSetScratchLimit(_rnnPtr, value))
+                throw new Exception("Failed to set scratch limit");
+        }
+    }
+
     /// <summary>
     /// Returns result of evaluation of the RNN at the given <param name="input"/>.
     /// </summary>
@@ -74,6 +198,113 @@ public class Rnn : IDisposable
         return result;
     }
 
+    /// <summary>
+    /// Evaluates the RNN at the given <param name="input"/> and writes the result into the given <param name="output"/>.
+    /// Returns number of written elements or "-1" if evaluation failed (e.g., if <param name="output"/> is too short).
+    /// Does not allocate managed memory.
+    /// </summary>
+    public int Evaluate(ReadOnlySpan<double> input, Span<double> output) =>
+        NativeDllWrapper.RnnEvaluateToBuffer(_rnnPtr, input.Length, in MemoryMarshal.GetReference(input),
+            output.Length, ref MemoryMarshal.GetReference(output));
+
+    /// <summary>
+    /// Returns concatenated results of evaluation of the RNN at each of the input items
+    /// packed into the given <param name="inputAggregate"/> (in the same way as for <see cref="Train"/>).
+    /// </summary>
+    public double[] EvaluateBatch(double[] inputAggregate)
+    {
+        double[] result = null;
+
+        if (!NativeDllWrapper.RnnEvaluateBatch(_rnnPtr, inputAggregate.Length, inputAggregate,
+                (_, r) => { result = r; }))
+            return null;
+
+        return result;
+    }
+
+    /// <summary>
+    /// Evaluates the RNN at each of the input items packed into the given <param name="inputAggregate"/>
+    /// and writes concatenation of the results into the given <param name="outputAggregate"/>.
+    /// Returns number of written elements or "-1" if evaluation failed. Does not allocate managed memory.
+    /// </summary>
+    public int EvaluateBatch(ReadOnlySpan<double> inputAggregate, Span<double> outputAggregate) =>
+        NativeDllWrapper.RnnEvaluateBatchToBuffer(_rnnPtr, inputAggregate.Length,
+            in MemoryMarshal.GetReference(inputAggregate), outputAggregate.Length,
+            ref MemoryMarshal.GetReference(outputAggregate));
+
+    /// <summary>
+    /// Single precision version of <see cref="EvaluateBatch(ReadOnlySpan{double}, Span{double})"/>.
+    /// Is preferable when <see cref="SinglePrecision"/> is "true" since no data conversion is needed then.
+    /// </summary>
+    public int EvaluateBatch(ReadOnlySpan<float> inputAggregate, Span<float> outputAggregate) =>
+        NativeDllWrapper.RnnEvaluateBatchToBufferSingle(_rnnPtr, inputAggregate.Length,
+            in MemoryMarshal.GetReference(inputAggregate), outputAggregate.Length,
+            ref MemoryMarshal.GetReference(outputAggregate));
+
+    /// <summary>
+    /// Number of features computed per k-line by the native feature-engineering stage
+    /// (the input item size of an RNN to be fed with k-lines).
+    /// </summary>
+    public static int KLineFeatureCount => NativeDllWrapper.KLineFeatureCount();
+
+    /// <summary>
+    /// Evaluates the RNN at each sliding window of the features of the given k-lines
+    /// (computed natively, see <see cref="KLineFeatureCount"/>) and returns the concatenated results.
+    /// </summary>
+    public double[] EvaluateKLines(KLineColumns kLines, int normalizationWindow)
+    {
+        var windowCount = Math.Max(kLines.Count - Depth + 1, 0);
+        var result = new double[windowCount * Depth * OutputItemSize];
+
+        if (windowCount == 0 || NativeDllWrapper.RnnEvaluateKLines(_rnnPtr, kLines.Count, kLines.OpenPrice,
+                kLines.HighPrice, kLines.LowPrice, kLines.ClosePrice, kLines.Volume, kLines.TradeCount,
+                normalizationWindow, result.Length, ref MemoryMarshal.GetArrayDataReference(result)) != result.Length)
+            throw new Exception("Failed to evaluate the RNN on the k-lines");
+
+        return result;
+    }
+
+    /// <summary>
+    /// The same as <see cref="EvaluateKLines(KLineColumns, int)"/> but takes the k-lines
+    /// directly from the given block of the <paramref name="archive"/>.
+    /// </summary>
+    public double[] EvaluateKLines(KLineArchive archive, int blockId, int normalizationWindow)
+    {
+        var windowCount = Math.Max(archive.GetBlockInfo(blockId).KLineCount - Depth + 1, 0);
+        var result = new double[windowCount * Depth * OutputItemSize];
+
+        if (windowCount == 0 || NativeDllWrapper.RnnEvaluateArchiveBlock(_rnnPtr, archive.Ptr, blockId,
+                normalizationWindow, result.Length, ref MemoryMarshal.GetArrayDataReference(result)) != result.Length)
+            throw new Exception("Failed to evaluate the RNN on the k-lines of the archive");
+
+        return result;
+    }
+
+    /// <summary>
+    /// Performs a training iteration on all the sliding windows of the features of the given k-lines.
+    /// The reference of each time-point is "1" if the next k-line closes higher and "0" otherwise.
+    /// </summary>
+    public bool TrainKLines(KLineColumns kLines, int normalizationWindow, double learningRate) =>
+        NativeDllWrapper.RnnTrainKLines(_rnnPtr, kLines.Count, kLines.OpenPrice, kLines.HighPrice,
+            kLines.LowPrice, kLines.ClosePrice, kLines.Volume, kLines.TradeCount, normalizationWindow, learningRate);
+
+    /// <summary>
+    /// Returns an evaluation context acquired from the native pool of the current RNN.
+    /// Contexts allow evaluating the same RNN from several threads simultaneously
+    /// (one context per thread) and must be disposed before the RNN.
+    /// </summary>
+    public RnnEvaluationContext AcquireContext() => new(this);
+
+    /// <summary>
+    /// The same as <see cref="EvaluateBatch(ReadOnlySpan{double}, Span{double})"/>
+    /// but uses the given evaluation <param name="context"/>.
+    /// </summary>
+    public int EvaluateBatch(RnnEvaluationContext context, ReadOnlySpan<double> inputAggregate,
+        Span<double> outputAggregate) =>
+        NativeDllWrapper.RnnEvaluateBatchInContext(_rnnPtr, context.Ptr, inputAggregate.Length,
+            in MemoryMarshal.GetReference(inputAggregate), outputAggregate.Length,
+            ref MemoryMarshal.GetReference(outputAggregate));
+
     /// <summary>
     /// Runs a single batch-training iteration on the given data.
     /// </summary>
@@ -83,6 +314,97 @@ public class Rnn : IDisposable
             input, reference.Length, reference, learningRate);
     }
 
+    /// <summary>
+    /// Single precision version of <see cref="Train(double[], double[], double)"/>.
+    /// Is preferable when <see cref="SinglePrecision"/> is "true" since no data conversion is needed then.
+    /// </summary>
+    public bool Train(float[] input, float[] reference, double learningRate)
+    {
+        return NativeDllWrapper.RnnBatchTrainSingle(_rnnPtr, input.Length,
+            input, reference.Length, reference, learningRate);
+    }
+
+    /// <summary>
+    /// Runs a multi-epoch training on the given data set (packed the same way as for <see cref="Train"/>)
+    /// in a single native call. Returns summary of the training or "null" if the training failed.
+    /// </summary>
+    public RnnFitResult? Fit(double[] input, double[] reference, RnnFitOptions options)
+    {
+        if (!NativeDllWrapper.RnnFit(_rnnPtr, input.Length, input, reference.Length,
+                reference, options, out var result))
+            return null;
+
+        return result;
+    }
+
+    /// <summary>
+    /// Starts a multi-epoch training on a native worker thread (see <see cref="Fit"/>) and returns the job;
+    /// <paramref name="onEpoch"/> (if not null) is called from the worker thread after each epoch.
+    /// </summary>
+    public RnnTrainingJob StartFit(double[] input, double[] reference, RnnFitOptions options,
+        Action<int, double> onEpoch = null) => new(this, input, reference, options, onEpoch);
+
+    /// <summary>
+    /// Performs a single batch-training iteration on all the windows of the given series. The windows have
+    /// length equal to <see cref="Depth"/> and start at each <paramref name="stride"/>-th time-point;
+    /// the same windows of <paramref name="referenceSeries"/> serve as references.
+    /// Each time-point is passed to the native side only once no matter how many windows it belongs to.
+    /// </summary>
+    public bool TrainSeries(double[] inputSeries, double[] referenceSeries, int stride, double learningRate) =>
+        NativeDllWrapper.RnnTrainSeries(_rnnPtr, inputSeries.Length, inputSeries,
+            referenceSeries.Length, referenceSeries, stride, learningRate);
+
+    /// <summary>
+    /// Performs a single batch-training iteration on sequences of arbitrary lengths stored one after another in the
+    /// given series (truncated backpropagation through time). Sequences shorter than <see cref="Depth"/> are padded
+    /// and their padding is masked out; longer ones are split into windows of length <see cref="Depth"/> ending
+    /// each <paramref name="truncationLength"/> time-points (0 means <see cref="Depth"/>), whose leading time-points
+    /// only warm up the state of the net. Each time-point of a sequence contributes to the cost exactly once.
+    /// </summary>
+    public bool TrainSequences(double[] inputSeries, double[] referenceSeries, int[] sequenceLengths,
+        int truncationLength, double learningRate) =>
+        NativeDllWrapper.RnnTrainSequences(_rnnPtr, sequenceLengths.Length, sequenceLengths,
+            inputSeries.Length, inputSeries, referenceSeries.Length, referenceSeries, truncationLength, learningRate);
+
+    /// <summary>
+    /// The same as <see cref="Fit"/> but the training pairs are the windows of the given series
+    /// (see <see cref="TrainSeries"/>). Returns summary of the training or "null" if the training failed.
+    /// </summary>
+    public RnnFitResult? FitSeries(double[] inputSeries, double[] referenceSeries, int stride, RnnFitOptions options)
+    {
+        if (!NativeDllWrapper.RnnFitSeries(_rnnPtr, inputSeries.Length, inputSeries, referenceSeries.Length,
+                referenceSeries, stride, options, out var result))
+            return null;
+
+        return result;
+    }
+
+    /// <summary>
+    /// Returns snapshot of the native hot-path counters of the RNN
+    /// (all zeros if <see cref="InstrumentationEnabled"/> is "false").
+    /// </summary>
+    public RnnStats GetStats()
+    {
+        if (!NativeDllWrapper.RnnGetStats(_rnnPtr, out var result))
+            throw new Exception("Failed to get stats of the RNN");
+
+        return result;
+    }
+
+    /// <summary>
+    /// Sets all the native hot-path counters of the RNN to zero.
+    /// </summary>
+    public void ResetStats()
+    {
+        if (!NativeDllWrapper.RnnResetStats(_rnnPtr))
+            throw new Exception("Failed to reset stats of the RNN");
+    }
+
+    /// <summary>
+    /// Returns "true" if the native DLL is compiled with the hot-path instrumentation on.
+    /// </summary>
+    public static bool InstrumentationEnabled => NativeDllWrapper.IsInstrumentationEnabled();
+
     /// <summary>
     /// Returns "true" if the native DLL is compiled against "single" precision arithmetics.
     /// </summary>
@@ -0,0 +1,112 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Wrapper of a native ensemble of RNNs (e.g., variants of different depths and layer sizes) evaluated
+/// at the same input in a single call. The members must have the same input and output item sizes.
+/// </summary>
+public class RnnEnsemble : IDisposable
+{
+    private IntPtr _ensemblePtr;
+
+    /// <summary>
+    /// The members of the ensemble (the references keep the RNNs alive while the ensemble exists).
+    /// </summary>
+    private readonly Rnn[] _members;
+
+    /// <summary>
+    /// Constructor.
+    /// </summary>
+    /// <param name="members">The RNNs constituting the ensemble.</param>
+    /// <param name="weights">Non-negative weights of the members in the average (null means equal weights).</param>
+    public RnnEnsemble(Rnn[] members, double[] weights = null)
+    {
+        if (weights != null && weights.Length != members.Length)
+            throw new Exception("Invalid number of weights");
+
+        _members = members.ToArray();
+        _ensemblePtr = NativeDllWrapper.RnnEnsembleConstruct(_members.Length,
+            _members.Select(x => x.Ptr).ToArray(), weights);
+
+        if (_ensemblePtr == IntPtr.Zero)
+            throw new Exception("Failed to instantiate an RNN ensemble");
+    }
+
+    /// <summary>
+    /// Finalizer.
+    /// </summary>
+    ~RnnEnsemble() => Dispose();
+
+    /// <summary>
+    /// Number of members.
+    /// </summary>
+    public int MemberCount => _members.Length;
+
+    /// <summary>
+    /// Number of time-point items an input must consist of (the maximal depth of the members).
+    /// Each member is evaluated at the latest time-points of the input.
+    /// </summary>
+    public int Depth => NativeDllWrapper.RnnEnsembleGetDepth(_ensemblePtr);
+
+    /// <summary>
+    /// Size of an output item of the members.
+    /// </summary>
+    public int OutputItemSize => _members[0].OutputItemSize;
+
+    /// <summary>
+    /// Evaluates all the members at the given input and writes the weighted average of their outputs corresponding
+    /// to the latest time-point into <paramref name="output"/>; if <paramref name="memberOutputs"/> is not empty,
+    /// the outputs of the members themselves are written there (one after another).
+    /// Returns number of elements written into <paramref name="output"/> or "-1" in case of failure.
+    /// </summary>
+    public int Evaluate(ReadOnlySpan<double> input, Span<double> output, Span<double> memberOutputs) =>
+        NativeDllWrapper.RnnEnsembleEvaluate(_ensemblePtr, input.Length, in MemoryMarshal.GetReference(input),
+            output.Length, ref MemoryMarshal.GetReference(output), memberOutputs.Length,
+            ref memberOutputs.IsEmpty ? ref Unsafe.NullRef<double>() : ref MemoryMarshal.GetReference(memberOutputs));
+
+    /// <summary>
+    /// Returns the weighted average of the outputs of the members (corresponding to the latest time-point)
+    /// evaluated at the given input.
+    /// </summary>
+    public double[] Evaluate(double[] input)
+    {
+        var output = new double[OutputItemSize];
+
+        if (Evaluate(input, output, Span<double>.Empty) != output.Length)
+            throw new Exception("Failed to evaluate the RNN ensemble");
+
+        return output;
+    }
+
+    /// <summary>
+    /// Disposes the current instance.
+    /// </summary>
+    public void Dispose()
+    {
+        if (_ensemblePtr == IntPtr.Zero) return;
+
+        if (!NativeDllWrapper.RnnEnsembleFree(_ensemblePtr))
+            throw new Exception("Failed to dispose an RNN ensemble");
+
+        _ensemblePtr = IntPtr.Zero;
+        GC.SuppressFinalize(this);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Wrapper of a native evaluation context of an RNN.
+/// An instance must not be used by several threads simultaneously.
+/// </summary>
+public class RnnEvaluationContext : IDisposable
+{
+    /// <summary>
+    /// The RNN the context was acquired from.
+    /// </summary>
+    private readonly Rnn _rnn;
+
+    /// <summary>
+    /// Pointer to the native context.
+    /// </summary>
+    internal IntPtr Ptr { get; private set; }
+
+    /// <summary>
+    /// Constructor.
+    /// </summary>
+    internal RnnEvaluationContext(Rnn rnn)
+    {
+        _rnn = rnn;
+        Ptr = NativeDllWrapper.RnnAcquireContext(rnn.Ptr);
+
+        if (Ptr == IntPtr.Zero)
+            throw new Exception("Failed to acquire an RNN evaluation context");
+    }
+
+    /// <summary>
+    /// Returns the context back to the pool of the RNN.
+    /// </summary>
+    public void Dispose()
+    {
+        if (Ptr == IntPtr.Zero) return;
+
+        if (!NativeDllWrapper.RnnReleaseContext(_rnn.Ptr, Ptr))
+            throw new Exception("Failed to release an RNN evaluation context");
+
+        Ptr = IntPtr.Zero;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+using System.Runtime.InteropServices;
+
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Parameters of a multi-epoch training of <see cref="Rnn"/>.
+/// The layout must match the one of the native "FitOptions" structure.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct RnnFitOptions
+{
+    /// <summary>
+    /// Constructor.
+    /// </summary>
+    public RnnFitOptions() {}
+
+    /// <summary>
+    /// Maximal number of passes through the training part of the data set.
+    /// </summary>
+    public int EpochCount = 1;
+
+    /// <summary>
+    /// Number of training pairs in a mini-batch.
+    /// </summary>
+    public int BatchSize = 1;
+
+    /// <summary>
+    /// Factor determining aggressiveness of the training.
+    /// </summary>
+    public double LearningRate = 0.1;
+
+    /// <summary>
+    /// Fraction (in [0, 1)) of the data set to be held out for validation
+    /// (the validation pairs are taken from the end of the data set).
+    /// </summary>
+    public double ValidationFraction = 0;
+
+    /// <summary>
+    /// Number of consecutive epochs without improvement of the validation cost after which the training stops.
+    /// Non-positive value disables early stopping.
+    /// </summary>
+    public int Patience = 0;
+
+    /// <summary>
+    /// Seed of the random generator used to shuffle the training pairs.
+    /// </summary>
+    public uint Seed = 0;
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+using System.Runtime.InteropServices;
+
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Summary of a multi-epoch training of <see cref="Rnn"/>.
+/// The layout must match the one of the native "FitResult" structure.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public readonly struct RnnFitResult
+{
+    /// <summary>
+    /// Number of performed epochs.
+    /// </summary>
+    public readonly int EpochCount;
+
+    /// <summary>
+    /// Zero-based index of the epoch with the lowest validation cost (or "-1" if there was no validation).
+    /// The weights of this epoch are restored when the training ends.
+    /// </summary>
+    public readonly int BestEpoch;
+
+    /// <summary>
+    /// The lowest validation cost (average per element).
+    /// </summary>
+    public readonly double BestValidationCost;
+
+    /// <summary>
+    /// Validation cost after the last performed epoch (average per element).
+    /// </summary>
+    public readonly double LastValidationCost;
+}
\ No newline at end of file
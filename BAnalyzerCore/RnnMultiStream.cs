@@ -0,0 +1,92 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+using System.Runtime.InteropServices;
+
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Wrapper of a native set of independent evaluation streams of the same RNN (e.g., one per trading symbol)
+/// that are advanced in lockstep: each <see cref="PushAll"/> call appends one time-point item to every stream,
+/// and the streams are evaluated in parallel natively.
+/// </summary>
+public class RnnMultiStream : IDisposable
+{
+    private IntPtr _multiStreamPtr;
+
+    /// <summary>
+    /// The RNN the streams are attached to (the reference keeps the RNN alive while the streams exist).
+    /// </summary>
+    private readonly Rnn _rnn;
+
+    /// <summary>
+    /// Constructor.
+    /// </summary>
+    public RnnMultiStream(Rnn rnn, int streamCount)
+    {
+        _rnn = rnn;
+        StreamCount = streamCount;
+        _multiStreamPtr = NativeDllWrapper.RnnMultiStreamOpen(rnn.Ptr, streamCount);
+
+        if (_multiStreamPtr == IntPtr.Zero)
+            throw new Exception("Failed to instantiate an RNN multi-stream");
+    }
+
+    /// <summary>
+    /// Finalizer.
+    /// </summary>
+    ~RnnMultiStream() => Dispose();
+
+    /// <summary>
+    /// Number of streams.
+    /// </summary>
+    public int StreamCount { get; }
+
+    /// <summary>
+    /// Appends a time-point item to each of the streams (<paramref name="items"/> contains
+    /// <see cref="StreamCount"/> items one after another). Returns number of streams whose windows are complete,
+    /// which is "0" until the streams accumulate <see cref="Rnn.Depth"/> items, or "-1" in case of failure.
+    /// </summary>
+    public int PushAll(ReadOnlySpan<double> items) =>
+        NativeDllWrapper.RnnMultiStreamPushAll(_multiStreamPtr, items.Length, in MemoryMarshal.GetReference(items));
+
+    /// <summary>
+    /// Writes outputs of the RNN corresponding to the latest time-point of each stream into the given
+    /// <paramref name="output"/> (one after another). Returns number of written elements, which is "0"
+    /// if the windows of the streams are not complete yet, or "-1" in case of failure.
+    /// </summary>
+    public int ReadAll(Span<double> output) =>
+        NativeDllWrapper.RnnMultiStreamReadAll(_multiStreamPtr, output.Length, ref MemoryMarshal.GetReference(output));
+
+    /// <summary>
+    /// Discards all the items pushed into all the streams.
+    /// </summary>
+    public bool Reset() => NativeDllWrapper.RnnMultiStreamReset(_multiStreamPtr);
+
+    /// <summary>
+    /// Disposes the current instance.
+    /// </summary>
+    public void Dispose()
+    {
+        if (_multiStreamPtr == IntPtr.Zero) return;
+
+        if (!NativeDllWrapper.RnnMultiStreamClose(_multiStreamPtr))
+            throw new Exception("Failed to dispose an RNN multi-stream");
+
+        _multiStreamPtr = IntPtr.Zero;
+        GC.SuppressFinalize(this);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+using System.Runtime.InteropServices;
+
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Parameters of the optimizer of <see cref="Rnn"/>.
+/// The layout must match the one of the native "OptimizerOptions" structure.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct RnnOptimizerOptions
+{
+    /// <summary>
+    /// Constructor.
+    /// </summary>
+    public RnnOptimizerOptions() {}
+
+    /// <summary>
+    /// The optimizer.
+    /// </summary>
+    public RnnOptimizer Optimizer = RnnOptimizer.Sgd;
+
+    /// <summary>
+    /// Decay factor (in [0, 1)) of the first moment of the gradient
+    /// (momentum of <see cref="RnnOptimizer.Momentum"/>, "beta1" of the Adam optimizers).
+    /// </summary>
+    public double Beta1 = 0.9;
+
+    /// <summary>
+    /// Decay factor (in [0, 1)) of the second moment of the gradient ("beta2" of the Adam optimizers).
+    /// </summary>
+    public double Beta2 = 0.999;
+
+    /// <summary>
+    /// Term added to the denominator of the Adam updates to improve numerical stability.
+    /// </summary>
+    public double Epsilon = 1e-8;
+
+    /// <summary>
+    /// Decoupled weight decay factor (<see cref="RnnOptimizer.AdamW"/> only).
+    /// </summary>
+    public double WeightDecay = 0.01;
+
+    /// <summary>
+    /// Number of consecutive training calls whose gradients are accumulated before the weights get updated.
+    /// </summary>
+    public int AccumulationSteps = 1;
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+using System.Runtime.InteropServices;
+
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Snapshot of the hot-path counters of a native <see cref="Rnn"/> (times are in nanoseconds).
+/// The layout must match the one of the native "RnnStats" structure.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public readonly struct RnnStats
+{
+    /// <summary>
+    /// Number of evaluation calls.
+    /// </summary>
+    public readonly long EvaluateCallCount;
+
+    /// <summary>
+    /// Number of evaluated input items.
+    /// </summary>
+    public readonly long EvaluatedItemCount;
+
+    /// <summary>
+    /// Number of performed training batches.
+    /// </summary>
+    public readonly long TrainBatchCount;
+
+    /// <summary>
+    /// Number of input-reference pairs the net was trained on.
+    /// </summary>
+    public readonly long TrainedPairCount;
+
+    /// <summary>
+    /// Number of bytes of the input, output and reference data converted to or from the native tensors.
+    /// </summary>
+    public readonly long ConvertedByteCount;
+
+    /// <summary>
+    /// Number of (re)allocations of the native tensors holding the converted data
+    /// (allocations made inside the layers of the RNN are not counted).
+    /// </summary>
+    public readonly long AllocationCount;
+
+    /// <summary>
+    /// Time spent on data conversion.
+    /// </summary>
+    public readonly long ConversionTimeNs;
+
+    /// <summary>
+    /// Time spent on forward passes of evaluation.
+    /// </summary>
+    public readonly long ForwardTimeNs;
+
+    /// <summary>
+    /// Time spent on sequential training (backward pass together with the weight update).
+    /// </summary>
+    public readonly long LearnTimeNs;
+
+    /// <summary>
+    /// Time spent on calculation of gradients in parallel training.
+    /// </summary>
+    public readonly long GradientTimeNs;
+
+    /// <summary>
+    /// Time spent on reduction of gradients and weight update in parallel training.
+    /// </summary>
+    public readonly long UpdateTimeNs;
+
+    /// <summary>
+    /// Time spent in the managed callbacks receiving results of evaluation.
+    /// </summary>
+    public readonly long CallbackTimeNs;
+}
\ No newline at end of file
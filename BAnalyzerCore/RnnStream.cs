@@ -0,0 +1,80 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+using System.Runtime.InteropServices;
+
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Wrapper of a native evaluation stream of an RNN that is meant for "live" inference:
+/// input time-point items are pushed one by one, and the window of the latest "depth" items is kept natively.
+/// </summary>
+public class RnnStream : IDisposable
+{
+    private IntPtr _streamPtr;
+
+    /// <summary>
+    /// The RNN the stream is attached to (the reference keeps the RNN alive while the stream exists).
+    /// </summary>
+    private readonly Rnn _rnn;
+
+    /// <summary>
+    /// Constructor.
+    /// </summary>
+    public RnnStream(Rnn rnn)
+    {
+        _rnn = rnn;
+        _streamPtr = NativeDllWrapper.RnnStreamOpen(rnn.Ptr);
+
+        if (_streamPtr == IntPtr.Zero)
+            throw new Exception("Failed to instantiate an RNN stream");
+    }
+
+    /// <summary>
+    /// Finalizer.
+    /// </summary>
+    ~RnnStream() => Dispose();
+
+    /// <summary>
+    /// Pushes the given time-point <param name="item"/> into the stream and writes output of the RNN
+    /// that corresponds to the latest time-point into the given <param name="output"/>.
+    /// Returns number of written elements, which is "0" until the stream accumulates
+    /// <see cref="Rnn.Depth"/> items, or "-1" in case of failure. Does not allocate managed memory.
+    /// </summary>
+    public int Push(ReadOnlySpan<double> item, Span<double> output) =>
+        NativeDllWrapper.RnnStreamPush(_streamPtr, item.Length, in MemoryMarshal.GetReference(item),
+            output.Length, ref MemoryMarshal.GetReference(output));
+
+    /// <summary>
+    /// Discards all the items pushed into the stream.
+    /// </summary>
+    public bool Reset() => NativeDllWrapper.RnnStreamReset(_streamPtr);
+
+    /// <summary>
+    /// Disposes the current instance.
+    /// </summary>
+    public void Dispose()
+    {
+        if (_streamPtr == IntPtr.Zero) return;
+
+        if (!NativeDllWrapper.RnnStreamClose(_streamPtr))
+            throw new Exception("Failed to dispose an RNN stream");
+
+        _streamPtr = IntPtr.Zero;
+        GC.SuppressFinalize(this);
+    }
+}
\ No newline at end of file
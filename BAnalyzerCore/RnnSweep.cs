@@ -0,0 +1,75 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Hyperparameter sweep: trains a grid of candidate RNNs concurrently on the native side and ranks them
+/// by the cost on the held-out part of the series (see <see cref="Run"/>).
+/// </summary>
+public static class RnnSweep
+{
+    /// <summary>
+    /// A candidate configuration of the sweep.
+    /// </summary>
+    /// <param name="Depth">Recursion depth of the net.</param>
+    /// <param name="LayerItemSizes">Item sizes of all the layers including the input one.</param>
+    /// <param name="LayerActivations">Activation functions of the layers (one less than the number of
+    /// item sizes) or null if all the layers should use sigmoid.</param>
+    public record Candidate(int Depth, int[] LayerItemSizes, RnnActivation[] LayerActivations = null);
+
+    /// <summary>
+    /// A trained candidate of the sweep.
+    /// </summary>
+    /// <param name="Config">Configuration of the candidate.</param>
+    /// <param name="Fit">Summary of the training of the candidate.</param>
+    /// <param name="Net">The trained net (to be disposed by the caller).</param>
+    public record Result(Candidate Config, RnnFitResult Fit, Rnn Net);
+
+    /// <summary>
+    /// Trains the nets of the given <paramref name="candidates"/> on the windows of the given series (see
+    /// <see cref="Rnn.FitSeries"/>) and returns them ordered by the best validation cost (the lowest first); the
+    /// <see cref="RnnFitOptions.ValidationFraction"/> of the <paramref name="options"/> must be positive.
+    /// The series are passed to the native side once and shared by all the candidates, which are trained on
+    /// <paramref name="threadCount"/> threads (0 means the number of hardware threads).
+    /// </summary>
+    public static IReadOnlyList<Result> Run(IReadOnlyList<Candidate> candidates, double[] inputSeries,
+        double[] referenceSeries, int stride, RnnFitOptions options, RnnCost cost = RnnCost.CrossEntropy,
+        int threadCount = 0)
+    {
+        if (candidates.Count == 0)
+            throw new Exception("No candidates to train");
+
+        if (candidates.Any(x => x.LayerActivations != null && x.LayerActivations.Length != x.LayerItemSizes.Length - 1))
+            throw new Exception("Invalid number of activation functions");
+
+        var netPtrs = new IntPtr[candidates.Count];
+        var outcomes = new RnnSweepOutcome[candidates.Count];
+
+        if (!NativeDllWrapper.RnnSweep(candidates.Count, candidates.Select(x => x.Depth).ToArray(),
+                candidates.Select(x => x.LayerItemSizes.Length).ToArray(),
+                candidates.SelectMany(x => x.LayerItemSizes).ToArray(),
+                candidates.All(x => x.LayerActivations == null) ? null : candidates.SelectMany(x =>
+                    x.LayerActivations ?? Enumerable.Repeat(RnnActivation.Sigmoid, x.LayerItemSizes.Length - 1)).ToArray(),
+                cost, inputSeries.Length, inputSeries, referenceSeries.Length, referenceSeries,
+                stride, options, threadCount, netPtrs, outcomes))
+            throw new Exception("The hyperparameter sweep has failed");
+
+        var nets = netPtrs.Select(x => new Rnn(x)).ToArray();
+
+        return outcomes.Select(x => new Result(candidates[x.CandidateId], x.Fit, nets[x.CandidateId])).ToArray();
+    }
+}
\ No newline at end of file
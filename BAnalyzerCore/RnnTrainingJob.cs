@@ -0,0 +1,104 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Wrapper of a native multi-epoch training job running on a native worker thread
+/// (evaluations of the RNN can proceed while the job is running).
+/// </summary>
+public class RnnTrainingJob : IDisposable
+{
+    private IntPtr _jobPtr;
+
+    /// <summary>
+    /// The RNN being trained (the reference keeps the RNN alive while the job exists).
+    /// </summary>
+    private readonly Rnn _rnn;
+
+    /// <summary>
+    /// The callback passed to the native code (the reference keeps it alive while the job exists).
+    /// </summary>
+    private readonly NativeDllWrapper.EpochCostCallBack _epochCallback;
+
+    /// <summary>
+    /// Constructor. Starts the training; <paramref name="onEpoch"/> (if not null) is called
+    /// on a native worker thread after each epoch with the index of the epoch and the cost after it.
+    /// </summary>
+    public RnnTrainingJob(Rnn rnn, double[] input, double[] reference, RnnFitOptions options,
+        Action<int, double> onEpoch = null)
+    {
+        _rnn = rnn;
+        _epochCallback = onEpoch != null ? (epochId, cost) => onEpoch(epochId, cost) : null;
+        _jobPtr = NativeDllWrapper.RnnTrainAsync(rnn.Ptr, input.Length, input,
+            reference.Length, reference, options, _epochCallback);
+
+        if (_jobPtr == IntPtr.Zero)
+            throw new Exception("Failed to start a training job");
+    }
+
+    /// <summary>
+    /// Finalizer.
+    /// </summary>
+    ~RnnTrainingJob() => Dispose();
+
+    /// <summary>
+    /// Requests the job to stop after the mini-batch that is in progress.
+    /// </summary>
+    public void Cancel()
+    {
+        if (!NativeDllWrapper.RnnJobCancel(_jobPtr))
+            throw new Exception("Failed to cancel the training job");
+    }
+
+    /// <summary>
+    /// Waits until the job is finished or <paramref name="timeoutMs"/> milliseconds elapse
+    /// (negative value means "no timeout") and returns the status of the job.
+    /// </summary>
+    public RnnTrainingJobStatus Wait(int timeoutMs = -1)
+    {
+        var status = NativeDllWrapper.RnnJobWait(_jobPtr, timeoutMs);
+
+        if (status < 0)
+            throw new Exception("Failed to wait for the training job");
+
+        return (RnnTrainingJobStatus)status;
+    }
+
+    /// <summary>
+    /// Current status of the job.
+    /// </summary>
+    public RnnTrainingJobStatus Status => Wait(0);
+
+    /// <summary>
+    /// Summary of the training or null if the job is not finished yet.
+    /// </summary>
+    public RnnFitResult? Result => NativeDllWrapper.RnnJobGetResult(_jobPtr, out var result) ? result : null;
+
+    /// <summary>
+    /// Disposes the current instance (cancels the job and waits until it is finished).
+    /// </summary>
+    public void Dispose()
+    {
+        if (_jobPtr == IntPtr.Zero) return;
+
+        if (!NativeDllWrapper.RnnJobFree(_jobPtr))
+            throw new Exception("Failed to dispose a training job");
+
+        _jobPtr = IntPtr.Zero;
+        GC.SuppressFinalize(this);
+    }
+}
\ No newline at end of file
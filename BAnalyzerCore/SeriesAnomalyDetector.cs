@@ -0,0 +1,86 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+using System.Runtime.InteropServices;
+
+namespace BAnalyzerCore;
+
+/// <summary>
+/// Wrapper of a native streaming detector of anomalies (spikes or change points) in a series of values.
+/// The detector keeps the recent history of the series, so that each new value costs O(history length).
+/// </summary>
+public class SeriesAnomalyDetector : IDisposable
+{
+    private IntPtr _detectorPtr;
+
+    /// <summary>
+    /// Constructor.
+    /// </summary>
+    /// <param name="kind">Kind of the anomalies to detect.</param>
+    /// <param name="historyLength">Number of the last values anomalies are judged against.</param>
+    /// <param name="confidence">Confidence (in percents) required to report an anomaly.</param>
+    public SeriesAnomalyDetector(AnomalyKind kind, int historyLength, double confidence = 95.0)
+    {
+        _detectorPtr = NativeDllWrapper.AnomalyDetectorConstruct(kind, historyLength, confidence);
+
+        if (_detectorPtr == IntPtr.Zero)
+            throw new Exception("Failed to instantiate an anomaly detector");
+    }
+
+    /// <summary>
+    /// Finalizer.
+    /// </summary>
+    ~SeriesAnomalyDetector() => Dispose();
+
+    /// <summary>
+    /// Processes the given next values of the series and returns
+    /// zero-based indices (within <paramref name="values"/>) of the anomalous ones.
+    /// </summary>
+    public int[] Push(ReadOnlySpan<double> values)
+    {
+        var anomalyIds = new int[values.Length];
+        var anomalyCount = NativeDllWrapper.AnomalyDetectorPush(_detectorPtr, values.Length,
+            in MemoryMarshal.GetReference(values), anomalyIds.Length, ref MemoryMarshal.GetArrayDataReference(anomalyIds));
+
+        if (anomalyCount < 0)
+            throw new Exception("Failed to process values of the series");
+
+        return anomalyIds[..anomalyCount];
+    }
+
+    /// <summary>
+    /// Discards the history of the series.
+    /// </summary>
+    public void Reset()
+    {
+        if (!NativeDllWrapper.AnomalyDetectorReset(_detectorPtr))
+            throw new Exception("Failed to reset the anomaly detector");
+    }
+
+    /// <summary>
+    /// Disposes the current instance.
+    /// </summary>
+    public void Dispose()
+    {
+        if (_detectorPtr == IntPtr.Zero) return;
+
+        if (!NativeDllWrapper.AnomalyDetectorFree(_detectorPtr))
+            throw new Exception("Failed to dispose an anomaly detector");
+
+        _detectorPtr = IntPtr.Zero;
+        GC.SuppressFinalize(this);
+    }
+}
\ No newline at end of file
@@ -15,12 +15,12 @@
 //OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
 //SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
-using Microsoft.ML;
-
 namespace BAnalyzerCore;
 
 /// <summary>
 /// Functionality for statistical analysis of time dependent data.
+/// Each call analyzes the given series from scratch; a series that is analyzed
+/// again as it grows should rather be fed to a <see cref="KLineAnomalyTracker"/>.
 /// </summary>
 public class TimeSeriesAnalyzer
 {
@@ -36,39 +36,24 @@ public class TimeSeriesAnalyzer
     }
 
     /// <summary>
-    /// Output data (prediction)
+    /// Confidence (in percents) required to report an anomaly.
     /// </summary>
-    public class Output
-    {
-        public double[] Prediction;
-    }
+    private const double Confidence = 95.0;
 
     /// <summary>
-    /// Creates instance of an output data view.
+    /// Returns indices of the items in the given time series that correspond to anomalies of the given kind.
     /// </summary>
-    private static IDataView CreateEmptyDataView(MLContext mlContext) =>
-        mlContext.Data.LoadFromEnumerable(new List<Input>());
+    private static int[] DetectAnomalies(IList<Input> input, AnomalyKind kind, int windowSize)
+    {
+        using var detector = new SeriesAnomalyDetector(kind, windowSize, Confidence);
+        return detector.Push(input.Select(x => (double)x.InData).ToArray());
+    }
 
     /// <summary>
     /// Returns indices of the items in the given time series that correspond to "spikes".
     /// </summary>
-    public static int[] DetectSpikes(IList<Input> input, int windowSize = 4)
-    {
-        var mlContext = new MLContext();
-        var dataView = mlContext.Data.LoadFromEnumerable(input);
-            
-        var iidSpikeEstimator = mlContext.Transforms.DetectIidSpike(outputColumnName: nameof(Output.Prediction),
-            inputColumnName: nameof(Input.InData), confidence: 95.0, pvalueHistoryLength: windowSize);
-
-        var iidSpikeTransform = iidSpikeEstimator.Fit(CreateEmptyDataView(mlContext));
-
-        var transformedData = iidSpikeTransform.Transform(dataView);
-
-        var predictions = mlContext.Data.CreateEnumerable<Output>(transformedData, reuseRowObject: false);
-
-        return predictions.Select((x, i) => x.Prediction[0] >= 0.9999 ? i : -1).
-            Where(x => x >= 0).ToArray();
-    }
+    public static int[] DetectSpikes(IList<Input> input, int windowSize = 4) =>
+        DetectAnomalies(input, AnomalyKind.Spike, windowSize);
 
     /// <summary>
     /// Returns indices of the items in the given time series that correspond to "spikes" (async version).
@@ -79,21 +64,8 @@ public class TimeSeriesAnalyzer
     /// <summary>
     /// Returns indices of the items in the given time series that correspond to "change points".
     /// </summary>
-    public static int[] DetectChangePoints(IList<Input> input, int windowSize = 4)
-    {
-        var mlContext = new MLContext();
-        var dataView = mlContext.Data.LoadFromEnumerable(input);
-
-        var iidChangePointEstimator = mlContext.Transforms.DetectIidChangePoint(outputColumnName: nameof(Output.Prediction),
-            inputColumnName: nameof(Input.InData), confidence: 95.0, changeHistoryLength: windowSize);
-
-        var iidChangePointTransform = iidChangePointEstimator.Fit(CreateEmptyDataView(mlContext));
-        var transformedData = iidChangePointTransform.Transform(dataView);
-        var predictions = mlContext.Data.CreateEnumerable<Output>(transformedData, reuseRowObject: false);
-
-        return predictions.Select((x, i) => x.Prediction[0] >= 0.9999 ? i : -1).
-            Where(x => x >= 0).ToArray();
-    }
+    public static int[] DetectChangePoints(IList<Input> input, int windowSize = 4) =>
+        DetectAnomalies(input, AnomalyKind.ChangePoint, windowSize);
 
     /// <summary>
     /// Returns indices of the items in the given time series that correspond to "change points" (async version).
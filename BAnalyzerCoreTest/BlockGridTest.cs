@@ -334,4 +334,34 @@ public class BlockGridTest
             indicator.End.Should().Be(data.ExpectedRightIndicatorPoint, "because this is the expected support point from the right");
         }
     }
+
+    [TestMethod]
+    [DataRow(false)]
+    [DataRow(true)]
+    public void ArchiveSaveLoadTest(bool compress)
+    {
+        // Arrange
+        var (grid, block0, block1) = CreateStandardGridWithTwoDistinctBlocks();
+        grid.Refine(5);
+        var folderPath = Directory.CreateTempSubdirectory().FullName;
+
+        try
+        {
+            // Act
+            grid.SaveArchive(folderPath, compress, null);
+            var loadedGrid = BlockGrid.LoadArchive(grid.Granularity, folderPath, null);
+
+            // Assert
+            BlockGrid.HasArchive(folderPath).Should().BeTrue("because the grid was just archived");
+            loadedGrid.Blocks.Should().HaveCount(grid.Blocks.Count, "because all the blocks must be archived");
+            loadedGrid.Blocks.Zip(grid.Blocks, (x, y) => ((KLineBlock)x).IsEqualTo((KLineBlock)y)).All(x => x)
+                .Should().BeTrue("because the archive must preserve the data");
+
+            RunExtensiveDataRetrievalTest([block0, block1], loadedGrid);
+        }
+        finally
+        {
+            Directory.Delete(folderPath, recursive: true);
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,123 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+using BAnalyzerCore;
+using BAnalyzerCore.DataStructures;
+
+namespace BAnalyzerCoreTest;
+
+[TestClass]
+public class IndicatorEngineTest
+{
+    private static readonly IndicatorSpec[] Indicators =
+    [
+        new(IndicatorType.Sma, 14),
+        new(IndicatorType.Ema, 14),
+        new(IndicatorType.Rsi, 14),
+        new(IndicatorType.BollingerUpper, 20, 2),
+        new(IndicatorType.BollingerLower, 20, 2),
+        new(IndicatorType.Vwap, 20),
+        new(IndicatorType.Atr, 14),
+    ];
+
+    /// <summary>
+    /// Returns a random walk of k-lines.
+    /// </summary>
+    private static KLine[] GenerateKLines(int count, int seed)
+    {
+        var rnd = new Random(seed);
+        var price = 100.0;
+        var result = new KLine[count];
+
+        for (var itemId = 0; itemId < count; itemId++)
+        {
+            price += rnd.NextDouble() - 0.5;
+            result[itemId] = new KLine
+            {
+                OpenPrice = price,
+                ClosePrice = price,
+                HighPrice = price + rnd.NextDouble(),
+                LowPrice = price - rnd.NextDouble(),
+                Volume = 10 * rnd.NextDouble(),
+            };
+        }
+
+        return result;
+    }
+
+    [TestMethod]
+    public void RollingIndicatorsTest()
+    {
+        // Arrange
+        var kLines = GenerateKLines(1000, seed: 1);
+        using var engine = new IndicatorEngine(Indicators);
+
+        // Act
+        var values = engine.Update(new KLineColumns(kLines));
+
+        // Assert
+        Assert.AreEqual(kLines.Length * Indicators.Length, values.Length, "Unexpected number of values");
+        Assert.AreEqual((long)kLines.Length, engine.KLineCount, "Unexpected number of processed k-lines");
+
+        for (var t = 0; t < kLines.Length; t++)
+        {
+            var smaWindow = kLines[Math.Max(t - 13, 0)..(t + 1)];
+            Assert.AreEqual(smaWindow.Average(x => x.ClosePrice), values[t * Indicators.Length], 1e-8,
+                "Unexpected SMA");
+
+            var window = kLines[Math.Max(t - 19, 0)..(t + 1)];
+            var mean = window.Average(x => x.ClosePrice);
+            var deviation = Math.Sqrt(window.Average(x => (x.ClosePrice - mean) * (x.ClosePrice - mean)));
+            Assert.AreEqual(mean + 2 * deviation, values[t * Indicators.Length + 3], 1e-6, "Unexpected upper band");
+            Assert.AreEqual(mean - 2 * deviation, values[t * Indicators.Length + 4], 1e-6, "Unexpected lower band");
+
+            var vwap = window.Sum(x => (x.HighPrice + x.LowPrice + x.ClosePrice) / 3 * x.Volume) /
+                       window.Sum(x => x.Volume);
+            Assert.AreEqual(vwap, values[t * Indicators.Length + 5], 1e-8, "Unexpected VWAP");
+
+            var rsi = values[t * Indicators.Length + 2];
+            Assert.IsTrue(rsi is >= 0 and <= 100, "RSI is out of range");
+        }
+    }
+
+    [TestMethod]
+    public void IncrementalUpdateTest()
+    {
+        // Arrange
+        var kLines = GenerateKLines(700, seed: 2);
+        using var batchEngine = new IndicatorEngine(Indicators);
+        using var incrementalEngine = new IndicatorEngine(Indicators);
+
+        // Act
+        var batchValues = batchEngine.Update(new KLineColumns(kLines));
+        var incrementalValues = incrementalEngine.Update(new KLineColumns(kLines[..300]))
+            .Concat(kLines[300..].SelectMany(incrementalEngine.Append)).ToArray();
+
+        // Assert
+        Assert.AreEqual(batchValues.Length, incrementalValues.Length, "Unexpected number of values");
+
+        for (var valueId = 0; valueId < batchValues.Length; valueId++)
+            Assert.AreEqual(batchValues[valueId], incrementalValues[valueId], 1e-10,
+                "Incremental update must match the batch one");
+
+        incrementalEngine.Reset();
+        Assert.AreEqual(0L, incrementalEngine.KLineCount, "Reset must discard the processed k-lines");
+        var restartedValues = incrementalEngine.Append(kLines[0]);
+
+        for (var valueId = 0; valueId < restartedValues.Length; valueId++)
+            Assert.AreEqual(batchValues[valueId], restartedValues[valueId], "Reset engine must behave as a new one");
+    }
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+using BAnalyzerCore;
+using BAnalyzerCore.DataStructures;
+
+namespace BAnalyzerCoreTest;
+
+[TestClass]
+public class KLineAnomalyTrackerTest
+{
+    private const int HistoryLength = 20;
+
+    /// <summary>
+    /// Returns one-minute k-lines starting at the given time whose low prices are the given values.
+    /// </summary>
+    private static KLine[] GenerateSticks(DateTime beginTime, IList<double> lowPrices) =>
+        lowPrices.Select((x, i) => new KLine
+        {
+            OpenTime = beginTime.AddMinutes(i),
+            CloseTime = beginTime.AddMinutes(i + 1).AddSeconds(-1),
+            LowPrice = x,
+        }).ToArray();
+
+    [TestMethod]
+    public void IncrementalUpdateTest()
+    {
+        // Arrange
+        var rnd = new Random(1);
+        var values = Enumerable.Range(0, 300).Select(i => rnd.NextDouble() + (i % 37 == 0 ? 10 : 0)).ToArray();
+        var sticks = GenerateSticks(new DateTime(2025, 1, 1, 0, 0, 0, DateTimeKind.Utc), values);
+        var now = sticks.Last().CloseTime;
+        const int frameLength = 100;
+        using var detector = new SeriesAnomalyDetector(AnomalyKind.Spike, HistoryLength);
+        using var tracker = new KLineAnomalyTracker(x => x.LowPrice);
+
+        var expectedAnomalyTimes = detector.Push(values).Select(x => sticks[x].OpenTime).ToArray();
+        Assert.IsTrue(expectedAnomalyTimes.Length > 0, "Anomalies were expected to be detected");
+
+        // Act
+        // The displayed frame slides along the series as new k-lines come.
+        for (var frameEnd = frameLength; frameEnd <= sticks.Length; frameEnd += 7)
+        {
+            var frame = sticks[Math.Max(frameEnd - frameLength, 0)..frameEnd];
+            var anomalyIds = tracker.Update("series", frame, AnomalyKind.Spike, HistoryLength, now);
+
+            // Assert
+            var frameAnomalyTimes = anomalyIds.Select(x => frame[x].OpenTime).ToArray();
+            var expectedFrameAnomalyTimes = expectedAnomalyTimes.
+                Where(x => x >= frame.First().OpenTime && x <= frame.Last().OpenTime).ToArray();
+            Assert.IsTrue(expectedFrameAnomalyTimes.SequenceEqual(frameAnomalyTimes),
+                "Incremental detection is expected to match the detection on the whole series");
+        }
+    }
+
+    [TestMethod]
+    public void OpenKLineTest()
+    {
+        // Arrange
+        var values = Enumerable.Range(0, 50).Select(i => i == 49 ? 100.0 : 1 + 0.01 * (i % 5)).ToArray();
+        var sticks = GenerateSticks(new DateTime(2025, 1, 1, 0, 0, 0, DateTimeKind.Utc), values);
+        using var tracker = new KLineAnomalyTracker(x => x.LowPrice);
+
+        // Act
+        var openAnomalyIds = tracker.Update("series", sticks, AnomalyKind.Spike, HistoryLength, sticks[^2].CloseTime);
+        var closedAnomalyIds = tracker.Update("series", sticks, AnomalyKind.Spike, HistoryLength, sticks[^1].CloseTime);
+
+        // Assert
+        Assert.IsFalse(openAnomalyIds.Contains(sticks.Length - 1), "Open k-line is not expected to be judged");
+        Assert.IsTrue(closedAnomalyIds.Contains(sticks.Length - 1), "The spike was not detected after the k-line closed");
+    }
+}
\ No newline at end of file
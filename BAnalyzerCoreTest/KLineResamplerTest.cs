@@ -0,0 +1,98 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+using BAnalyzerCore;
+using BAnalyzerCore.DataStructures;
+using Binance.Net.Enums;
+
+namespace BAnalyzerCoreTest;
+
+[TestClass]
+public class KLineResamplerTest
+{
+    private static readonly TimeGranularity Hour = new("1h", 60 * 60);
+
+    /// <summary>
+    /// Returns a series of one-minute k-lines that starts in the middle of an hour.
+    /// </summary>
+    private static IReadOnlyList<KLine> GenerateMinuteKLines(int count) =>
+        KLineGenerator.GenerateBlock(new DateTime(2025, 1, 1, 10, 25, 0, DateTimeKind.Utc),
+            KlineInterval.OneMinute, count).Data;
+
+    [TestMethod]
+    public void ResampleTest()
+    {
+        // Arrange
+        var kLines = GenerateMinuteKLines(200);
+
+        // Act
+        var bars = KLineResampler.Resample(kLines, Hour);
+
+        // Assert
+        var expectedGroups = kLines.GroupBy(x => new DateTime(x.OpenTime.Year, x.OpenTime.Month,
+            x.OpenTime.Day, x.OpenTime.Hour, 0, 0, DateTimeKind.Utc)).ToArray();
+        Assert.AreEqual(expectedGroups.Length, bars.Count, "Unexpected number of k-lines");
+
+        for (var barId = 0; barId < bars.Count; barId++)
+        {
+            var bar = bars[barId];
+            var group = expectedGroups[barId].ToArray();
+            Assert.AreEqual(expectedGroups[barId].Key, bar.OpenTime, "Unexpected open time");
+            Assert.AreEqual(bar.OpenTime.Add(Hour.Span).AddMilliseconds(-1), bar.CloseTime, "Unexpected close time");
+            Assert.AreEqual(group.First().OpenPrice, bar.OpenPrice, "Unexpected open price");
+            Assert.AreEqual(group.Last().ClosePrice, bar.ClosePrice, "Unexpected close price");
+            Assert.AreEqual(group.Max(x => x.HighPrice), bar.HighPrice, "Unexpected high price");
+            Assert.AreEqual(group.Min(x => x.LowPrice), bar.LowPrice, "Unexpected low price");
+            Assert.AreEqual(group.Sum(x => x.Volume), bar.Volume, 1e-10, "Unexpected volume");
+            Assert.AreEqual(group.Sum(x => x.QuoteVolume), bar.QuoteVolume, 1e-10, "Unexpected quote volume");
+            Assert.AreEqual(group.Sum(x => x.TakerBuyBaseVolume), bar.TakerBuyBaseVolume, 1e-10,
+                "Unexpected taker buy base volume");
+            Assert.AreEqual(group.Sum(x => x.TakerBuyQuoteVolume), bar.TakerBuyQuoteVolume, 1e-10,
+                "Unexpected taker buy quote volume");
+            Assert.AreEqual(group.Sum(x => (long)x.TradeCount), (long)bar.TradeCount, "Unexpected trade count");
+        }
+    }
+
+    [TestMethod]
+    public void StreamingResampleTest()
+    {
+        // Arrange
+        var kLines = GenerateMinuteKLines(200);
+        var expectedBars = KLineResampler.Resample(kLines, Hour);
+        using var resampler = new KLineResampler(Hour);
+
+        // Act
+        var completedBars = new List<KLine>();
+
+        foreach (var kLine in kLines)
+        {
+            // A "live" version of the k-line is pushed first and then refreshed with the final one.
+            completedBars.AddRange(resampler.Push([kLine with { ClosePrice = 0.5, Volume = 1000 }]));
+            completedBars.AddRange(resampler.Push([kLine]));
+        }
+
+        // Assert
+        Assert.AreEqual(expectedBars.Count - 1, completedBars.Count, "Unexpected number of completed k-lines");
+
+        for (var barId = 0; barId < completedBars.Count; barId++)
+            Assert.AreEqual(expectedBars[barId], completedBars[barId], "Streaming must match the batch resampling");
+
+        Assert.AreEqual(expectedBars.Last(), resampler.OpenBar, "Unexpected open k-line");
+
+        resampler.Reset();
+        Assert.IsNull(resampler.OpenBar, "Reset must discard the open k-line");
+    }
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+using BAnalyzerCore;
+
+namespace BAnalyzerCoreTest;
+
+[TestClass]
+public class LiveOrderBookTest
+{
+    /// <summary>
+    /// Returns an order book initialized with a snapshot of 10 bid levels (100.0 down to 99.1)
+    /// and 10 ask levels (100.1 up to 101.0) with quantities equal to the level indices plus one.
+    /// </summary>
+    private static LiveOrderBook CreateBook(long updateId)
+    {
+        var book = new LiveOrderBook("BTCUSDT");
+        // Bids are passed in the reversed order on purpose.
+        var bidPrices = Enumerable.Range(0, 10).Reverse().Select(x => 100.0 - 0.1 * x).ToArray();
+        var bidQuantities = Enumerable.Range(0, 10).Reverse().Select(x => x + 1.0).ToArray();
+        var askPrices = Enumerable.Range(0, 10).Select(x => 100.1 + 0.1 * x).ToArray();
+        var askQuantities = Enumerable.Range(0, 10).Select(x => x + 1.0).ToArray();
+        book.ApplySnapshot(updateId, bidPrices, bidQuantities, askPrices, askQuantities);
+
+        return book;
+    }
+
+    [TestMethod]
+    public void SnapshotIsSortedTest()
+    {
+        // Arrange
+        using var book = CreateBook(updateId: 10);
+
+        // Act
+        var bids = book.Bids;
+        var asks = book.Asks;
+
+        // Assert
+        Assert.AreEqual(10L, book.UpdateId, "Unexpected update identifier");
+        Assert.AreEqual(10, bids.Length, "Unexpected number of bids");
+        Assert.AreEqual(10, asks.Length, "Unexpected number of asks");
+        Assert.AreEqual(100.0, bids[0].Price, 1e-12, "Unexpected best bid");
+        Assert.AreEqual(100.1, asks[0].Price, 1e-12, "Unexpected best ask");
+        Assert.IsTrue(bids.Zip(bids.Skip(1)).All(x => x.First.Price > x.Second.Price), "Bids must be sorted descending");
+        Assert.IsTrue(asks.Zip(asks.Skip(1)).All(x => x.First.Price < x.Second.Price), "Asks must be sorted ascending");
+        Assert.IsTrue(bids.Concat(asks).All(x => Math.Abs(x.Quantity - 1 - Math.Round(Math.Abs(x.Price - 100.05) / 0.1 - 0.5)) < 1e-9),
+            "Quantities do not match prices");
+    }
+
+    [TestMethod]
+    public void DiffApplicationTest()
+    {
+        // Arrange
+        using var book = CreateBook(updateId: 10);
+
+        // Act
+        // Removes the best bid, updates the second one and inserts a new one in between the sides.
+        var applied = book.ApplyDiff(9, 12, [100.0, 99.9, 100.05], [0.0, 7.0, 3.0], [101.5], [2.0]);
+        var stale = book.ApplyDiff(11, 12, [100.05], [0.0], [], []);
+        var gap = book.ApplyDiff(14, 15, [100.05], [0.0], [], []);
+
+        // Assert
+        Assert.AreEqual(OrderBookDiffResult.Applied, applied, "The diff must be applied");
+        Assert.AreEqual(OrderBookDiffResult.Stale, stale, "The diff must be ignored as a stale one");
+        Assert.AreEqual(OrderBookDiffResult.Gap, gap, "The gap must be reported");
+        Assert.AreEqual(12L, book.UpdateId, "Unexpected update identifier");
+
+        var bids = book.Bids;
+        Assert.AreEqual(10, bids.Length, "Unexpected number of bids");
+        Assert.AreEqual(100.05, bids[0].Price, 1e-12, "Unexpected best bid");
+        Assert.AreEqual(3.0, bids[0].Quantity, 1e-12, "Unexpected quantity of the best bid");
+        Assert.AreEqual(99.9, bids[1].Price, 1e-12, "Unexpected second bid");
+        Assert.AreEqual(7.0, bids[1].Quantity, 1e-12, "Unexpected quantity of the second bid");
+
+        var asks = book.Asks;
+        Assert.AreEqual(11, asks.Length, "Unexpected number of asks");
+        Assert.AreEqual(101.5, asks[^1].Price, 1e-12, "Unexpected worst ask");
+    }
+
+    [TestMethod]
+    public void AggregationTest()
+    {
+        // Arrange
+        using var book = CreateBook(updateId: 1);
+        const double bucketSize = 0.5;
+        var bids = book.Bids;
+        var expectedBuckets = bids.GroupBy(x => Math.Floor(x.Price / bucketSize + 1e-9) * bucketSize)
+            .Select(g => (Price: g.Key, Quantity: g.Sum(x => x.Quantity))).ToArray();
+        var prices = new double[bids.Length];
+        var quantities = new double[bids.Length];
+        var cumulative = new double[bids.Length];
+
+        // Act
+        var bucketCount = book.Aggregate(OrderBookSide.Bid, bucketSize, prices, quantities, cumulative);
+        var limitedCount = book.Aggregate(OrderBookSide.Bid, bucketSize, new double[1], new double[1], Span<double>.Empty);
+
+        // Assert
+        Assert.AreEqual(expectedBuckets.Length, bucketCount, "Unexpected number of buckets");
+        Assert.AreEqual(1, limitedCount, "Capacity of the buffers must be respected");
+
+        var runningTotal = 0.0;
+        for (var bucketId = 0; bucketId < bucketCount; bucketId++)
+        {
+            runningTotal += expectedBuckets[bucketId].Quantity;
+            Assert.AreEqual(expectedBuckets[bucketId].Price, prices[bucketId], 1e-12, "Unexpected price of a bucket");
+            Assert.AreEqual(expectedBuckets[bucketId].Quantity, quantities[bucketId], 1e-12, "Unexpected quantity of a bucket");
+            Assert.AreEqual(runningTotal, cumulative[bucketId], 1e-12, "Unexpected cumulative quantity");
+        }
+    }
+}
\ No newline at end of file
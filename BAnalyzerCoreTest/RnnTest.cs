@@ -17,6 +17,8 @@
 
 using System.Collections.Immutable;
 using BAnalyzerCore;
+using BAnalyzerCore.Persistence;
+using Binance.Net.Enums;
 
 namespace BAnalyzerCoreTest;
 
@@ -73,6 +75,447 @@ public class RnnTest
         Assert.IsFalse(result.All(x => x.Equals(0)), "Suspicious evaluation result");
     }
 
+    [TestMethod]
+    public void BatchEvaluationTest()
+    {
+        // Arrange
+        const int itemCount = 7;
+        var net = ConstructStandardRnn();
+        var input = GenerateRandomMultiCollection(_itemSizes.First(), itemCount);
+        var singleItemSize = net.InputItemSize * net.Depth;
+
+        var expectedResult = Enumerable.Range(0, itemCount).
+            SelectMany(i => net.Evaluate(input.Skip(i * singleItemSize).Take(singleItemSize).ToArray())).ToArray();
+
+        // Act
+        var result = net.EvaluateBatch(input);
+
+        // Assert
+        Assert.IsNotNull(result, "Failed to evaluate RNN");
+        Assert.AreEqual(itemCount * Depth * _itemSizes.Last(), result.Length, "Unexpected size of evaluation result");
+        Assert.IsTrue(result.SequenceEqual(expectedResult),
+            "Batch evaluation result differs from the result of item-by-item evaluation");
+    }
+
+    [TestMethod]
+    public void EvaluationIntoBufferTest()
+    {
+        // Arrange
+        var net = ConstructStandardRnn();
+        var input = GenerateRandomCollection(_itemSizes.First());
+        var expectedResult = net.Evaluate(input);
+        var output = new double[expectedResult.Length + 1];
+
+        // Act
+        var writtenCount = net.Evaluate(input, output);
+        var insufficientCapacityResult = net.Evaluate(input, output.AsSpan(0, expectedResult.Length - 1));
+
+        // Assert
+        Assert.AreEqual(expectedResult.Length, writtenCount, "Unexpected number of written elements");
+        Assert.IsTrue(output.Take(writtenCount).SequenceEqual(expectedResult),
+            "Result written into the buffer differs from the reference one");
+        Assert.AreEqual(-1, insufficientCapacityResult, "Evaluation into insufficient buffer must fail");
+    }
+
+    [TestMethod]
+    public void BatchEvaluationIntoBufferTest()
+    {
+        // Arrange
+        const int itemCount = 5;
+        var net = ConstructStandardRnn();
+        var input = GenerateRandomMultiCollection(_itemSizes.First(), itemCount);
+        var expectedResult = net.EvaluateBatch(input);
+        var output = new double[expectedResult.Length];
+
+        // Act
+        var writtenCount = net.EvaluateBatch(input, output);
+
+        // Assert
+        Assert.AreEqual(expectedResult.Length, writtenCount, "Unexpected number of written elements");
+        Assert.IsTrue(output.SequenceEqual(expectedResult),
+            "Result written into the buffer differs from the reference one");
+    }
+
+    [TestMethod]
+    public void StreamEvaluationTest()
+    {
+        // Arrange
+        const int extraItemCount = 3;
+        var net = ConstructStandardRnn();
+        var inItemSize = net.InputItemSize;
+        var outItemSize = net.OutputItemSize;
+        var series = Enumerable.Range(0, Depth + extraItemCount).
+            SelectMany(_ => Enumerable.Range(0, inItemSize).Select(_ => _rnd.NextDouble())).ToArray();
+        using var stream = new RnnStream(net);
+        var output = new double[outItemSize];
+
+        for (var itemId = 0; itemId < Depth + extraItemCount; itemId++)
+        {
+            // Act
+            var writtenCount = stream.Push(series.AsSpan(itemId * inItemSize, inItemSize), output);
+
+            // Assert
+            if (itemId < Depth - 1)
+            {
+                Assert.AreEqual(0, writtenCount, "No output is expected until the window is complete");
+                continue;
+            }
+
+            Assert.AreEqual(outItemSize, writtenCount, "Unexpected number of written elements");
+
+            var window = series.Skip((itemId - Depth + 1) * inItemSize).Take(Depth * inItemSize).ToArray();
+            var expectedOutput = net.Evaluate(window).TakeLast(outItemSize);
+            Assert.IsTrue(output.SequenceEqual(expectedOutput),
+                "Stream output differs from the output of the window evaluation");
+        }
+    }
+
+    [TestMethod]
+    public void MultiStreamEvaluationTest()
+    {
+        // Arrange
+        const int streamCount = 7;
+        using var net = ConstructStandardRnn();
+        var inItemSize = net.InputItemSize;
+        var outItemSize = net.OutputItemSize;
+        var series = Enumerable.Range(0, streamCount).Select(_ => GenerateRandomCollection(inItemSize)).ToArray();
+        using var multiStream = new RnnMultiStream(net, streamCount);
+        var output = new double[streamCount * outItemSize];
+
+        for (var itemId = 0; itemId < Depth; itemId++)
+        {
+            var items = series.SelectMany(x => x.Skip(itemId * inItemSize).Take(inItemSize)).ToArray();
+
+            // Act
+            var readyCount = multiStream.PushAll(items);
+            var writtenCount = multiStream.ReadAll(output);
+
+            // Assert
+            Assert.AreEqual(itemId < Depth - 1 ? 0 : streamCount, readyCount, "Unexpected number of ready streams");
+            Assert.AreEqual(itemId < Depth - 1 ? 0 : output.Length, writtenCount, "Unexpected number of written elements");
+        }
+
+        var expectedOutput = series.SelectMany(x => net.Evaluate(x).TakeLast(outItemSize));
+        Assert.IsTrue(output.SequenceEqual(expectedOutput),
+            "Multi-stream output differs from the outputs of the window evaluations");
+    }
+
+    [TestMethod]
+    public void MultiStreamMatchesStreamsTest()
+    {
+        // Arrange
+        // The number of streams is not a multiple of the number of worker threads.
+        const int streamCount = 37;
+        const int itemCount = Depth + 5;
+        using var net = ConstructStandardRnn();
+        var inItemSize = net.InputItemSize;
+        var outItemSize = net.OutputItemSize;
+        var series = Enumerable.Range(0, streamCount).Select(_ => GenerateRandomMultiCollection(inItemSize, 2)).ToArray();
+        using var multiStream = new RnnMultiStream(net, streamCount);
+        var streams = Enumerable.Range(0, streamCount).Select(_ => new RnnStream(net)).ToArray();
+        var output = new double[streamCount * outItemSize];
+        var streamOutput = new double[outItemSize];
+
+        try
+        {
+            for (var itemId = 0; itemId < itemCount; itemId++)
+            {
+                var items = series.SelectMany(x => x.Skip(itemId * inItemSize).Take(inItemSize)).ToArray();
+
+                // Act
+                multiStream.PushAll(items);
+                var writtenCount = multiStream.ReadAll(output);
+
+                // Assert
+                for (var streamId = 0; streamId < streamCount; streamId++)
+                {
+                    var streamWrittenCount = streams[streamId].Push(items.AsSpan(streamId * inItemSize, inItemSize), streamOutput);
+                    Assert.AreEqual(streamWrittenCount * streamCount, writtenCount, "Unexpected number of written elements");
+
+                    for (var elementId = 0; elementId < streamWrittenCount; elementId++)
+                        Assert.AreEqual(streamOutput[elementId], output[streamId * outItemSize + elementId],
+                            "Multi-stream output differs from the output of the corresponding stream");
+                }
+            }
+        }
+        finally
+        {
+            foreach (var stream in streams)
+                stream.Dispose();
+        }
+    }
+
+    [TestMethod]
+    public void EnsembleEvaluationTest()
+    {
+        // Arrange
+        const int shallowDepth = Depth - 5;
+        using var deepNet = ConstructStandardRnn();
+        using var shallowNet = new Rnn(shallowDepth, [_itemSizes.First(), 6, _itemSizes.Last()]);
+        double[] weights = [1, 3];
+        using var ensemble = new RnnEnsemble([deepNet, shallowNet], weights);
+        var outItemSize = deepNet.OutputItemSize;
+        var input = GenerateRandomCollection(deepNet.InputItemSize);
+        var output = new double[outItemSize];
+        var memberOutputs = new double[2 * outItemSize];
+
+        // Act
+        var writtenCount = ensemble.Evaluate(input, output, memberOutputs);
+
+        // Assert
+        Assert.AreEqual(Depth, ensemble.Depth, "Unexpected depth of the ensemble");
+        Assert.AreEqual(outItemSize, writtenCount, "Unexpected number of written elements");
+
+        var expectedDeepOutput = deepNet.Evaluate(input).TakeLast(outItemSize).ToArray();
+        var expectedShallowOutput = shallowNet.Evaluate(input.Skip((Depth - shallowDepth) * deepNet.InputItemSize)
+            .ToArray()).TakeLast(outItemSize).ToArray();
+        Assert.IsTrue(memberOutputs.SequenceEqual(expectedDeepOutput.Concat(expectedShallowOutput)),
+            "Unexpected outputs of the members");
+
+        for (var itemId = 0; itemId < outItemSize; itemId++)
+            Assert.AreEqual(0.25 * expectedDeepOutput[itemId] + 0.75 * expectedShallowOutput[itemId],
+                output[itemId], 1e-12, "Unexpected weighted average of the outputs");
+    }
+
+    [TestMethod]
+    public void SinglePrecisionBatchEvaluationTest()
+    {
+        // Arrange
+        const int itemCount = 5;
+        var net = ConstructStandardRnn();
+        var input = GenerateRandomMultiCollection(_itemSizes.First(), itemCount);
+        var expectedResult = net.EvaluateBatch(input);
+        var inputSingle = input.Select(x => (float)x).ToArray();
+        var output = new float[expectedResult.Length];
+
+        // Act
+        var writtenCount = net.EvaluateBatch(inputSingle, output);
+
+        // Assert
+        Assert.AreEqual(expectedResult.Length, writtenCount, "Unexpected number of written elements");
+        var maxDiff = output.Zip(expectedResult, (x, y) => Math.Abs(x - y)).Max();
+        Assert.IsTrue(maxDiff < 1e-5, "Single precision result differs too much from the reference one");
+    }
+
+    [TestMethod]
+    public void SaveLoadTest()
+    {
+        // Arrange
+        const int itemCount = 5;
+        using var net = ConstructStandardRnn();
+        var input = GenerateRandomMultiCollection(_itemSizes.First(), itemCount);
+        var expectedResult = net.EvaluateBatch(input);
+        var filePath = Path.GetTempFileName();
+
+        try
+        {
+            // Act
+            net.Save(filePath);
+            using var loadedNet = Rnn.Load(filePath);
+            var result = loadedNet.EvaluateBatch(input);
+
+            // Assert
+            Assert.AreEqual(net.InputItemSize, loadedNet.InputItemSize, "Unexpected input item size");
+            Assert.AreEqual(net.OutputItemSize, loadedNet.OutputItemSize, "Unexpected output item size");
+            Assert.IsTrue(expectedResult.SequenceEqual(result), "Loaded net is different from the saved one");
+            Assert.IsTrue(loadedNet.Train(input, expectedResult, 0.1),
+                "Loaded net was expected to allocate its training context on demand");
+        }
+        finally
+        {
+            File.Delete(filePath);
+        }
+    }
+
+    [TestMethod]
+    [DataRow(RnnWeightPrecision.Half, 1e-2)]
+    [DataRow(RnnWeightPrecision.Int8, 1e-1)]
+    public void QuantizedSaveLoadTest(RnnWeightPrecision precision, double tolerance)
+    {
+        // Arrange
+        const int itemCount = 5;
+        using var net = ConstructStandardRnn();
+        var input = GenerateRandomMultiCollection(_itemSizes.First(), itemCount);
+        var expectedResult = net.EvaluateBatch(input);
+        var fullFilePath = Path.GetTempFileName();
+        var quantizedFilePath = Path.GetTempFileName();
+
+        try
+        {
+            // Act
+            net.Save(fullFilePath);
+            net.Save(quantizedFilePath, precision);
+            using var loadedNet = Rnn.Load(quantizedFilePath);
+            var (_, maxDeviation) = CalcAverageAndMaxAbsDeviation(loadedNet, input, expectedResult);
+
+            // Assert
+            Assert.IsTrue(new FileInfo(quantizedFilePath).Length < new FileInfo(fullFilePath).Length,
+                "Quantized weights were expected to take less space");
+            Assert.IsTrue(maxDeviation < tolerance, "Too high deviation of the quantized net from the original one");
+            Assert.IsFalse(loadedNet.IsFrozen, "Net loaded from a compressed file was expected to be trainable");
+            Assert.IsTrue(loadedNet.Train(input, expectedResult, 0.1), "Net loaded from a compressed file can be trained");
+        }
+        finally
+        {
+            File.Delete(fullFilePath);
+            File.Delete(quantizedFilePath);
+        }
+    }
+
+    [TestMethod]
+    public void FreezeTest()
+    {
+        // Arrange
+        const int itemCount = 5;
+        using var net = ConstructStandardRnn();
+        var input = GenerateRandomMultiCollection(_itemSizes.First(), itemCount);
+        var reference = GenerateRandomMultiCollection(_itemSizes.Last(), itemCount);
+        net.ReserveScratch(itemCount, 0);
+        var expectedResult = net.EvaluateBatch(input);
+        var footprintBeforeFreeze = net.ScratchFootprint;
+
+        // Act
+        net.Freeze();
+
+        // Assert
+        Assert.IsTrue(net.IsFrozen, "The net was expected to be frozen");
+        Assert.IsTrue(expectedResult.SequenceEqual(net.EvaluateBatch(input)), "Freezing must not affect evaluation");
+        Assert.IsFalse(net.Train(input, reference, 0.1), "Frozen net can't be trained");
+        Assert.IsTrue(net.ScratchFootprint < footprintBeforeFreeze, "Training data was expected to be released");
+    }
+
+    [TestMethod]
+    public void KLineEvaluationAndTrainingTest()
+    {
+        // Arrange
+        const int kLineCount = 50;
+        const int normalizationWindow = 20;
+        using var net = new Rnn(Depth, [Rnn.KLineFeatureCount, 8, 1]);
+        var kLines = new KLineColumns(KLineGenerator.GenerateBlock(new DateTime(2025, 1, 1),
+            KlineInterval.OneMinute, kLineCount).Data);
+
+        // Act
+        var result = net.EvaluateKLines(kLines, normalizationWindow);
+        var trainingSucceeded = net.TrainKLines(kLines, normalizationWindow, 0.1);
+
+        // Assert
+        Assert.AreEqual((kLineCount - Depth + 1) * Depth, result.Length, "Unexpected size of the result");
+        Assert.IsTrue(result.All(x => x is > 0 and < 1), "Unexpected values of the result");
+        Assert.IsTrue(trainingSucceeded, "Training on k-lines failed");
+    }
+
+    [TestMethod]
+    public void EvaluateArchivedKLinesTest()
+    {
+        // Arrange
+        const int normalizationWindow = 20;
+        using var net = new Rnn(Depth, [Rnn.KLineFeatureCount, 8, 1]);
+        var block = KLineGenerator.GenerateBlock(new DateTime(2025, 1, 1), KlineInterval.OneMinute, 50);
+        var expectedResult = net.EvaluateKLines(new KLineColumns(block.Data), normalizationWindow);
+        var filePath = Path.GetTempFileName();
+
+        try
+        {
+            KLineArchive.Write(filePath, [block], compress: false);
+            using var archive = new KLineArchive(filePath);
+
+            // Act
+            var result = net.EvaluateKLines(archive, 0, normalizationWindow);
+
+            // Assert
+            Assert.IsTrue(expectedResult.SequenceEqual(result), "Archived k-lines must yield the same result");
+        }
+        finally
+        {
+            File.Delete(filePath);
+        }
+    }
+
+    [TestMethod]
+    public void ScratchReservationAndLimitTest()
+    {
+        // Arrange
+        const int batchSize = 10;
+        using var net = ConstructStandardRnn();
+        var input = GenerateRandomMultiCollection(_itemSizes.First(), batchSize);
+        var reference = GenerateRandomMultiCollection(_itemSizes.Last(), batchSize);
+        var realSize = net.SinglePrecision ? sizeof(float) : sizeof(double);
+        var batchByteSize = (long)(input.Length + reference.Length) * realSize;
+
+        // Act
+        net.ReserveScratch(batchSize, 2);
+        var footprint = net.ScratchFootprint;
+        net.ScratchLimit = batchByteSize - 1;
+        var limitedTrainingSucceeded = net.Train(input, reference, 0.1);
+        net.ScratchLimit = batchByteSize;
+        var trainingSucceeded = net.Train(input, reference, 0.1);
+
+        // Assert
+        Assert.IsTrue(footprint >= batchByteSize, "Unexpected footprint of the reserved scratch data");
+        Assert.IsFalse(limitedTrainingSucceeded, "Training exceeding the scratch limit must fail");
+        Assert.IsTrue(trainingSucceeded, "Training within the scratch limit must succeed");
+        Assert.AreEqual(footprint, net.ScratchFootprint, "Training within the reserved size must not grow the scratch data");
+    }
+
+    [TestMethod]
+    public void StatsTest()
+    {
+        // Arrange
+        const int itemCount = 5;
+        using var net = ConstructStandardRnn();
+        var input = GenerateRandomMultiCollection(_itemSizes.First(), itemCount);
+        var reference = GenerateRandomMultiCollection(_itemSizes.Last(), itemCount);
+        net.EvaluateBatch(input);
+        net.ResetStats();
+
+        // Act
+        net.EvaluateBatch(input);
+        net.Train(input, reference, 0.1);
+        var stats = net.GetStats();
+        net.ResetStats();
+        var statsAfterReset = net.GetStats();
+
+        // Assert
+        if (Rnn.InstrumentationEnabled)
+        {
+            Assert.AreEqual(1, stats.EvaluateCallCount, "Unexpected number of evaluation calls");
+            Assert.AreEqual(itemCount, stats.EvaluatedItemCount, "Unexpected number of evaluated items");
+            Assert.AreEqual(1, stats.TrainBatchCount, "Unexpected number of training batches");
+            Assert.AreEqual(itemCount, stats.TrainedPairCount, "Unexpected number of trained pairs");
+            Assert.IsTrue(stats.ConvertedByteCount > 0, "Converted data was expected to be counted");
+            Assert.IsTrue(stats.ForwardTimeNs > 0, "Forward pass time was expected to be measured");
+        }
+
+        Assert.AreEqual(default, statsAfterReset, "All the counters were expected to be zero after reset");
+    }
+
+    [TestMethod]
+    public void ConcurrentEvaluationTest()
+    {
+        // Arrange
+        const int taskCount = 16;
+        const int itemCount = 4;
+        var net = ConstructStandardRnn();
+        var inputs = Enumerable.Range(0, taskCount).
+            Select(_ => GenerateRandomMultiCollection(_itemSizes.First(), itemCount)).ToArray();
+        var expectedResults = inputs.Select(net.EvaluateBatch).ToArray();
+        var results = new double[taskCount][];
+
+        // Act
+        Parallel.For(0, taskCount, taskId =>
+        {
+            using var context = net.AcquireContext();
+            results[taskId] = new double[expectedResults[taskId].Length];
+            Assert.AreEqual(results[taskId].Length, net.EvaluateBatch(context, inputs[taskId], results[taskId]),
+                "Unexpected number of written elements");
+        });
+
+        // Assert
+        for (var taskId = 0; taskId < taskCount; taskId++)
+            Assert.IsTrue(results[taskId].SequenceEqual(expectedResults[taskId]),
+                "Result of concurrent evaluation differs from the reference one");
+    }
+
     /// <summary>
     /// Sigmoid function.
     /// </summary>
@@ -114,11 +557,13 @@ public class RnnTest
     }
 
     [TestMethod]
-    public void IdentityTrainingTest()
+    [DataRow(1)]
+    [DataRow(4)]
+    public void IdentityTrainingTest(int threadCount)
     {
         // Arrange
         var itemSize = 5;
-        var net = new Rnn(Depth, [5, 5]);
+        var net = new Rnn(Depth, [5, 5]) { ThreadCount = threadCount };
         var trainingIterations = 15000;
         var batchItemCount = 10;
 
@@ -142,4 +587,364 @@ public class RnnTest
         Assert.IsTrue(finalDeviationMax < (net.SinglePrecision ? 1e-7 : 1e-10),
             "Too high final deviation from reference.");
     }
+
+    [TestMethod]
+    [DataRow(RnnOptimizer.Momentum, 0.05)]
+    [DataRow(RnnOptimizer.Adam, 0.01)]
+    [DataRow(RnnOptimizer.AdamW, 0.01)]
+    public void IdentityOptimizedTrainingTest(RnnOptimizer optimizer, double learningRate)
+    {
+        // Arrange
+        const int itemSize = 5;
+        const int batchItemCount = 10;
+        var net = new Rnn(Depth, [itemSize, itemSize])
+        {
+            Optimizer = new RnnOptimizerOptions { Optimizer = optimizer, WeightDecay = 1e-4 },
+        };
+
+        var inputControl = GenerateRandomMultiCollection(itemSize, batchItemCount);
+        var outputControl = inputControl.Select(Sigmoid).ToArray();
+        var (initialDeviationAverage, _) = CalcAverageAndMaxAbsDeviation(net, inputControl, outputControl);
+
+        // Act
+        for (var iterId = 0; iterId < 1500; iterId++)
+        {
+            var input = GenerateRandomMultiCollection(itemSize, batchItemCount);
+            var reference = input.Select(Sigmoid).ToArray();
+
+            Assert.IsTrue(net.Train(input, reference, learningRate), "Training iteration has failed.");
+        }
+
+        // Assert
+        Assert.AreEqual(optimizer, net.Optimizer.Optimizer, "Unexpected optimizer of the net");
+        var (finalDeviationAverage, _) = CalcAverageAndMaxAbsDeviation(net, inputControl, outputControl);
+        Assert.IsTrue(finalDeviationAverage < initialDeviationAverage / 10, "Too high final deviation from reference.");
+    }
+
+    [TestMethod]
+    public void GradientAccumulationTest()
+    {
+        // Arrange
+        const int itemSize = 5;
+        var net = new Rnn(Depth, [itemSize, itemSize])
+        {
+            Optimizer = new RnnOptimizerOptions { AccumulationSteps = 2 },
+        };
+        var input = GenerateRandomMultiCollection(itemSize, 4);
+        var reference = input.Select(Sigmoid).ToArray();
+        var initialOutput = net.Evaluate(input.Take(itemSize * Depth).ToArray());
+
+        // Act
+        Assert.IsTrue(net.Train(input, reference, 0.1), "Training iteration has failed.");
+        var accumulatedOutput = net.Evaluate(input.Take(itemSize * Depth).ToArray());
+        Assert.IsTrue(net.Train(input, reference, 0.1), "Training iteration has failed.");
+        var updatedOutput = net.Evaluate(input.Take(itemSize * Depth).ToArray());
+
+        // Assert
+        Assert.IsTrue(initialOutput.SequenceEqual(accumulatedOutput),
+            "The weights must not change until all the accumulation steps are done");
+        Assert.IsFalse(initialOutput.SequenceEqual(updatedOutput),
+            "The weights were expected to change after the last accumulation step");
+        Assert.ThrowsException<Exception>(() =>
+            net.Optimizer = new RnnOptimizerOptions { Optimizer = RnnOptimizer.Adam, Beta1 = 1 });
+    }
+
+    [TestMethod]
+    public void IdentityFitTest()
+    {
+        // Arrange
+        const int itemSize = 5;
+        const int pairCount = 200;
+        var net = new Rnn(Depth, [itemSize, itemSize]);
+        var input = GenerateRandomMultiCollection(itemSize, pairCount);
+        var reference = input.Select(Sigmoid).ToArray();
+        var options = new RnnFitOptions
+        {
+            EpochCount = 300, BatchSize = 10, LearningRate = 0.1,
+            ValidationFraction = 0.1, Patience = 300, Seed = 1,
+        };
+
+        var inputControl = GenerateRandomMultiCollection(itemSize, 10);
+        var outputControl = inputControl.Select(Sigmoid).ToArray();
+        var (initialDeviationAverage, _) = CalcAverageAndMaxAbsDeviation(net, inputControl, outputControl);
+
+        // Act
+        var result = net.Fit(input, reference, options);
+
+        // Assert
+        Assert.IsNotNull(result, "Training has failed.");
+        Assert.AreEqual(options.EpochCount, result.Value.EpochCount, "Unexpected number of performed epochs");
+        Assert.IsTrue(result.Value.BestEpoch >= 0, "Validation was expected to take place");
+        Assert.IsTrue(result.Value.BestValidationCost <= result.Value.LastValidationCost,
+            "The best validation cost can't be higher than the last one");
+
+        var (finalDeviationAverage, _) = CalcAverageAndMaxAbsDeviation(net, inputControl, outputControl);
+        Assert.IsTrue(finalDeviationAverage < initialDeviationAverage / 10, "Too high final deviation from reference.");
+    }
+
+    [TestMethod]
+    public void PipelinedFitTest()
+    {
+        // Arrange
+        const int itemSize = 5;
+        const int pairCount = 45;
+        const int batchSize = 10;
+        using var net = new Rnn(Depth, [itemSize, itemSize]);
+        var input = GenerateRandomMultiCollection(itemSize, pairCount);
+        var reference = input.Select(Sigmoid).ToArray();
+        var options = new RnnFitOptions
+        {
+            EpochCount = 5, BatchSize = batchSize, LearningRate = 0.1, ValidationFraction = 0.2, Seed = 7,
+        };
+        var filePath = Path.GetTempFileName();
+
+        try
+        {
+            net.Save(filePath);
+            using var twinNet = Rnn.Load(filePath);
+            net.ReserveScratch(batchSize, 1);
+            var footprint = net.ScratchFootprint;
+
+            // Act
+            var result = net.Fit(input, reference, options);
+            var twinResult = twinNet.Fit(input, reference, options);
+
+            // Assert
+            Assert.IsNotNull(result, "Training has failed.");
+            Assert.IsNotNull(twinResult, "Training has failed.");
+            Assert.AreEqual(result.Value.LastValidationCost, twinResult.Value.LastValidationCost,
+                "Training with the background conversion of mini-batches must be deterministic");
+            Assert.IsTrue(net.EvaluateBatch(input).SequenceEqual(twinNet.EvaluateBatch(input)),
+                "Identical nets trained on identical data must stay identical");
+            Assert.AreEqual(footprint, net.ScratchFootprint,
+                "Both buffers of the mini-batches were expected to be reserved");
+        }
+        finally
+        {
+            File.Delete(filePath);
+        }
+    }
+
+    [TestMethod]
+    public void AsyncFitTest()
+    {
+        // Arrange
+        const int itemSize = 5;
+        const int pairCount = 100;
+        var net = new Rnn(Depth, [itemSize, itemSize]);
+        var input = GenerateRandomMultiCollection(itemSize, pairCount);
+        var reference = input.Select(Sigmoid).ToArray();
+        var options = new RnnFitOptions
+        {
+            EpochCount = 20, BatchSize = 10, LearningRate = 0.1,
+            ValidationFraction = 0.1, Seed = 1,
+        };
+        var reportedCosts = new List<double>();
+
+        // Act
+        using (var job = net.StartFit(input, reference, options, (_, cost) => reportedCosts.Add(cost)))
+        {
+            // Assert
+            Assert.AreEqual(RnnTrainingJobStatus.Completed, job.Wait(), "The job was expected to complete");
+            Assert.IsNotNull(job.Result, "Summary of the finished job is not available");
+            Assert.AreEqual(options.EpochCount, job.Result.Value.EpochCount, "Unexpected number of performed epochs");
+        }
+
+        Assert.AreEqual(options.EpochCount, reportedCosts.Count, "Each epoch was expected to be reported");
+        Assert.IsTrue(reportedCosts.Last() < reportedCosts.First(), "The reported cost was expected to decrease");
+
+        using var cancelledJob = net.StartFit(input, reference, options with { EpochCount = 1000000 });
+        cancelledJob.Cancel();
+        Assert.AreEqual(RnnTrainingJobStatus.Cancelled, cancelledJob.Wait(), "The job was expected to be cancelled");
+        Assert.IsTrue(cancelledJob.Result.Value.EpochCount < 1000000, "The cancelled job was not stopped");
+    }
+
+    [TestMethod]
+    public void LinearRegressionFitTest()
+    {
+        // Arrange
+        const int itemSize = 5;
+        const int pairCount = 200;
+        var net = new Rnn(Depth, [itemSize, itemSize], [RnnActivation.Linear], RnnCost.SquaredError);
+        var input = GenerateRandomMultiCollection(itemSize, pairCount);
+        var reference = input.Select(x => 3 * x - 1).ToArray();
+        var options = new RnnFitOptions
+        {
+            EpochCount = 300, BatchSize = 10, LearningRate = 0.01,
+            ValidationFraction = 0.1, Patience = 300, Seed = 1,
+        };
+
+        var inputControl = GenerateRandomMultiCollection(itemSize, 10);
+        var outputControl = inputControl.Select(x => 3 * x - 1).ToArray();
+        var (initialDeviationAverage, _) = CalcAverageAndMaxAbsDeviation(net, inputControl, outputControl);
+
+        // Act
+        var result = net.Fit(input, reference, options);
+
+        // Assert
+        Assert.IsNotNull(result, "Training has failed.");
+        var (finalDeviationAverage, _) = CalcAverageAndMaxAbsDeviation(net, inputControl, outputControl);
+        Assert.IsTrue(finalDeviationAverage < initialDeviationAverage / 10,
+            "Linear outputs were expected to fit the references outside of the sigmoid range.");
+    }
+
+    [TestMethod]
+    public void IdentitySeriesFitTest()
+    {
+        // Arrange
+        const int itemSize = 5;
+        const int stride = 3;
+        const int timePointCount = Depth + 199 * stride;
+        var net = new Rnn(Depth, [itemSize, itemSize]);
+        var inputSeries = GenerateRandomMultiCollection(itemSize, timePointCount / Depth + 1)
+            .Take(timePointCount * itemSize).ToArray();
+        var referenceSeries = inputSeries.Select(Sigmoid).ToArray();
+        var options = new RnnFitOptions
+        {
+            EpochCount = 300, BatchSize = 10, LearningRate = 0.1,
+            ValidationFraction = 0.1, Patience = 300, Seed = 1,
+        };
+
+        var inputControl = GenerateRandomMultiCollection(itemSize, 10);
+        var outputControl = inputControl.Select(Sigmoid).ToArray();
+        var (initialDeviationAverage, _) = CalcAverageAndMaxAbsDeviation(net, inputControl, outputControl);
+
+        // Act
+        var result = net.FitSeries(inputSeries, referenceSeries, stride, options);
+
+        // Assert
+        Assert.IsNotNull(result, "Training has failed.");
+        Assert.AreEqual(options.EpochCount, result.Value.EpochCount, "Unexpected number of performed epochs");
+        Assert.IsTrue(result.Value.BestEpoch >= 0, "Validation was expected to take place");
+
+        var (finalDeviationAverage, _) = CalcAverageAndMaxAbsDeviation(net, inputControl, outputControl);
+        Assert.IsTrue(finalDeviationAverage < initialDeviationAverage / 10, "Too high final deviation from reference.");
+    }
+
+    [TestMethod]
+    public void IdentitySequenceTrainingTest()
+    {
+        // Arrange
+        const int itemSize = 5;
+        const int truncationLength = 4;
+        var net = new Rnn(Depth, [itemSize, itemSize]);
+        int[] sequenceLengths = [3, Depth, 2 * Depth + 1];
+        var timePointCount = sequenceLengths.Sum();
+
+        var inputControl = GenerateRandomMultiCollection(itemSize, 10);
+        var outputControl = inputControl.Select(Sigmoid).ToArray();
+        var (initialDeviationAverage, _) = CalcAverageAndMaxAbsDeviation(net, inputControl, outputControl);
+
+        // Act
+        for (var iterId = 0; iterId < 3000; iterId++)
+        {
+            var inputSeries = GenerateRandomMultiCollection(itemSize, timePointCount / Depth + 1)
+                .Take(timePointCount * itemSize).ToArray();
+            var referenceSeries = inputSeries.Select(Sigmoid).ToArray();
+
+            Assert.IsTrue(net.TrainSequences(inputSeries, referenceSeries, sequenceLengths, truncationLength, 0.1),
+                "Training iteration has failed.");
+        }
+
+        // Assert
+        var (finalDeviationAverage, _) = CalcAverageAndMaxAbsDeviation(net, inputControl, outputControl);
+        Assert.IsTrue(finalDeviationAverage < initialDeviationAverage / 10, "Too high final deviation from reference.");
+
+        var series = new double[timePointCount * itemSize];
+        Assert.IsFalse(net.TrainSequences(series, series, [timePointCount - 1], truncationLength, 0.1),
+            "Lengths of the sequences must match the series");
+        Assert.IsFalse(net.TrainSequences(series, series, sequenceLengths, Depth + 1, 0.1),
+            "The truncation length can't exceed the depth of the net");
+    }
+
+    [TestMethod]
+    public void SweepTest()
+    {
+        // Arrange
+        const int itemSize = 5;
+        const int timePointCount = 300;
+        var inputSeries = GenerateRandomMultiCollection(itemSize, timePointCount / Depth)
+            .Take(timePointCount * itemSize).ToArray();
+        var referenceSeries = inputSeries.Select(Sigmoid).ToArray();
+        RnnSweep.Candidate[] candidates =
+        [
+            new(5, [itemSize, itemSize]),
+            new(10, [itemSize, itemSize]),
+            new(5, [itemSize, 8, itemSize], [RnnActivation.Tanh, RnnActivation.Sigmoid]),
+        ];
+        var options = new RnnFitOptions
+        {
+            EpochCount = 20, BatchSize = 10, LearningRate = 0.1, ValidationFraction = 0.2, Seed = 1,
+        };
+
+        // Act
+        var results = RnnSweep.Run(candidates, inputSeries, referenceSeries, 2, options, threadCount: 2);
+
+        // Assert
+        try
+        {
+            Assert.AreEqual(candidates.Length, results.Count, "Each candidate was expected to be reported");
+            Assert.AreEqual(candidates.Length, results.Select(x => x.Config).Distinct().Count(),
+                "Each candidate was expected to be reported once");
+
+            for (var resultId = 0; resultId < results.Count; resultId++)
+            {
+                var result = results[resultId];
+                Assert.AreEqual(options.EpochCount, result.Fit.EpochCount, "Unexpected number of performed epochs");
+                Assert.AreEqual(result.Config.Depth, result.Net.Depth, "The net does not match its candidate");
+                Assert.AreEqual(result.Config.LayerItemSizes.Length - 1, result.Net.LayerCount,
+                    "The net does not match its candidate");
+
+                if (resultId > 0)
+                    Assert.IsTrue(results[resultId - 1].Fit.BestValidationCost <= result.Fit.BestValidationCost,
+                        "The results must be ranked by the validation cost");
+            }
+
+            Assert.ThrowsException<Exception>(() => RnnSweep.Run(candidates, inputSeries, referenceSeries, 2,
+                options with { ValidationFraction = 0 }), "A sweep without held-out data must fail");
+        }
+        finally
+        {
+            foreach (var result in results)
+                result.Net.Dispose();
+        }
+    }
+
+    [TestMethod]
+    public void FitEarlyStoppingTest()
+    {
+        // Arrange
+        const int itemSize = 5;
+        const int halfPairCount = 10;
+        var net = new Rnn(Depth, [itemSize, itemSize]);
+        // The validation half of the data set contains the same inputs as the training one but
+        // "opposite" references, so that the validation cost grows as the training goes on.
+        var trainingInput = GenerateRandomMultiCollection(itemSize, halfPairCount);
+        var trainingReference = GenerateRandomMultiCollection(itemSize, halfPairCount);
+        var input = trainingInput.Concat(trainingInput).ToArray();
+        var reference = trainingReference.Concat(trainingReference.Select(x => 1 - x)).ToArray();
+        var options = new RnnFitOptions
+        {
+            EpochCount = 10000, BatchSize = 5, LearningRate = 0.5, ValidationFraction = 0.5, Patience = 3,
+        };
+
+        // Act
+        var result = net.Fit(input, reference, options);
+
+        // Assert
+        Assert.IsNotNull(result, "Training has failed.");
+        Assert.IsTrue(result.Value.EpochCount < options.EpochCount, "Training was expected to stop early");
+        Assert.AreEqual(result.Value.BestEpoch + options.Patience, result.Value.EpochCount - 1,
+            "Training should stop exactly after \"patience\" epochs without improvement");
+
+        // The net is expected to end up with the weights of the best epoch.
+        var validationOutput = net.EvaluateBatch(trainingInput);
+        var validationCost = -validationOutput.Zip(trainingReference.Select(x => 1 - x), (o, r) =>
+        {
+            var clamped = Math.Clamp(o, 1e-12, 1 - 1e-12);
+            return r * Math.Log(clamped) + (1 - r) * Math.Log(1 - clamped);
+        }).Sum() / validationOutput.Length;
+        Assert.AreEqual(result.Value.BestValidationCost, validationCost, 1e-5,
+            "Weights of the best epoch were expected to be restored");
+    }
 }
\ No newline at end of file
@@ -0,0 +1,70 @@
+﻿//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+using BAnalyzerCore;
+
+namespace BAnalyzerCoreTest;
+
+[TestClass]
+public class SeriesAnomalyDetectorTest
+{
+    private const int HistoryLength = 20;
+
+    /// <summary>
+    /// Returns a collection of normally distributed (zero mean, unit variance) values.
+    /// </summary>
+    private static double[] GenerateNoise(int count, int seed)
+    {
+        var rnd = new Random(seed);
+        return Enumerable.Range(0, count).Select(_ =>
+            Math.Sqrt(-2 * Math.Log(1 - rnd.NextDouble())) * Math.Cos(2 * Math.PI * rnd.NextDouble())).ToArray();
+    }
+
+    [TestMethod]
+    public void SpikeDetectionTest()
+    {
+        // Arrange
+        const int spikeId = 60;
+        var series = GenerateNoise(200, seed: 1);
+        series[spikeId] += 20;
+        using var detector = new SeriesAnomalyDetector(AnomalyKind.Spike, HistoryLength, confidence: 99);
+
+        // Act
+        var anomalyIds = detector.Push(series);
+
+        // Assert
+        Assert.IsTrue(anomalyIds.Contains(spikeId), "The spike was not detected");
+        Assert.IsTrue(anomalyIds.All(x => x >= HistoryLength), "No anomalies are expected during warm-up");
+    }
+
+    [TestMethod]
+    public void ChangePointDetectionTest()
+    {
+        // Arrange
+        const int shiftId = 120;
+        var series = GenerateNoise(200, seed: 2).Select((x, i) => i < shiftId ? x : x + 10).ToArray();
+        using var detector = new SeriesAnomalyDetector(AnomalyKind.ChangePoint, HistoryLength);
+
+        // Act
+        // Push the series in chunks to make sure the state is carried over between calls.
+        var anomalyIds = series.Chunk(7).SelectMany((chunk, chunkId) =>
+            detector.Push(chunk).Select(x => x + chunkId * 7)).ToArray();
+
+        // Assert
+        Assert.IsTrue(anomalyIds.Any(x => x is >= shiftId and < shiftId + 5), "The level shift was not detected");
+        Assert.IsTrue(anomalyIds.All(x => x >= HistoryLength), "No anomalies are expected during warm-up");
+    }
+}
\ No newline at end of file
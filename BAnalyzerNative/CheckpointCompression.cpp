@@ -0,0 +1,240 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "CheckpointCompression.h"
+#include "DataConversionUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <msgpack.hpp>
+
+namespace BAnalyzerNative
+{
+	namespace
+	{
+		using Packer = msgpack::packer<msgpack::sbuffer>;
+
+		/// <summary>
+		/// Types of the msgpack extensions holding quantized arrays.
+		/// </summary>
+		constexpr std::int8_t HalfArrayExtType = 1;
+		constexpr std::int8_t Int8ArrayExtType = 2;
+
+		/// <summary>
+		/// Header of the body of a quantized array extension. It is followed by "count" half precision values or by
+		/// ceil("count" / Int8BlockSize) single precision scale factors and "count" signed 8-bit values.
+		/// </summary>
+		struct QuantizedArrayHeader
+		{
+			std::uint32_t count;
+			std::uint32_t is_double;
+		};
+
+		/// <summary>
+		/// Returns "true" if the given object is a non-empty array of floating point values.
+		/// </summary>
+		bool is_float_array(const msgpack::object& obj)
+		{
+			if (obj.type != msgpack::type::ARRAY || obj.via.array.size == 0)
+				return false;
+
+			return std::all_of(obj.via.array.ptr, obj.via.array.ptr + obj.via.array.size, [](const msgpack::object& item)
+				{
+					return item.type == msgpack::type::FLOAT32 || item.type == msgpack::type::FLOAT64;
+				});
+		}
+
+		void pack_quantized_array(const msgpack::object& obj, const WeightPrecision precision, Packer& packer)
+		{
+			const auto count = obj.via.array.size;
+			std::vector<float> values(count);
+
+			for (auto value_id = 0u; value_id < count; ++value_id)
+				values[value_id] = static_cast<float>(obj.via.array.ptr[value_id].via.f64);
+
+			const QuantizedArrayHeader header{ count, obj.via.array.ptr[0].type == msgpack::type::FLOAT64 ? 1u : 0u };
+			std::vector<char> body(sizeof(header));
+			std::memcpy(body.data(), &header, sizeof(header));
+
+			if (precision == WeightPrecision::Half)
+			{
+				std::vector<std::uint16_t> half_values(count);
+				DataConversionUtils::to_half(values.data(), count, half_values.data());
+				body.resize(sizeof(header) + count * sizeof(std::uint16_t));
+				std::memcpy(body.data() + sizeof(header), half_values.data(), count * sizeof(std::uint16_t));
+			} else
+			{
+				const auto block_count = (count + CheckpointCompression::Int8BlockSize - 1) / CheckpointCompression::Int8BlockSize;
+				std::vector<float> scales(block_count);
+				std::vector<std::int8_t> int8_values(count);
+
+				for (auto block_id = 0u; block_id < block_count; ++block_id)
+				{
+					const auto begin = block_id * CheckpointCompression::Int8BlockSize;
+					const auto end = std::min<std::uint32_t>(begin + CheckpointCompression::Int8BlockSize, count);
+					auto max_abs = 0.0f;
+
+					for (auto value_id = begin; value_id < end; ++value_id)
+						max_abs = std::max(max_abs, std::abs(values[value_id]));
+
+					const auto scale = max_abs / 127.0f;
+					scales[block_id] = scale;
+
+					for (auto value_id = begin; value_id < end; ++value_id)
+						int8_values[value_id] = static_cast<std::int8_t>(scale > 0.0f ?
+							std::clamp(std::lround(values[value_id] / scale), -127l, 127l) : 0);
+				}
+
+				body.resize(sizeof(header) + block_count * sizeof(float) + count);
+				std::memcpy(body.data() + sizeof(header), scales.data(), block_count * sizeof(float));
+				std::memcpy(body.data() + sizeof(header) + block_count * sizeof(float), int8_values.data(), count);
+			}
+
+			packer.pack_ext(body.size(), precision == WeightPrecision::Half ? HalfArrayExtType : Int8ArrayExtType);
+			packer.pack_ext_body(body.data(), static_cast<std::uint32_t>(body.size()));
+		}
+
+		void pack_dequantized_array(const msgpack::object& obj, Packer& packer)
+		{
+			const auto body = obj.via.ext.data();
+			const auto body_size = static_cast<std::size_t>(obj.via.ext.size);
+			QuantizedArrayHeader header;
+
+			if (body_size < sizeof(header))
+				throw std::exception("Invalid quantized array.");
+
+			std::memcpy(&header, body, sizeof(header));
+			const auto count = header.count;
+			std::vector<float> values(count);
+
+			if (obj.via.ext.type() == HalfArrayExtType)
+			{
+				if (body_size != sizeof(header) + count * sizeof(std::uint16_t))
+					throw std::exception("Invalid quantized array.");
+
+				std::vector<std::uint16_t> half_values(count);
+				std::memcpy(half_values.data(), body + sizeof(header), count * sizeof(std::uint16_t));
+				DataConversionUtils::from_half(half_values.data(), count, values.data());
+			} else
+			{
+				const auto block_count = (count + CheckpointCompression::Int8BlockSize - 1) / CheckpointCompression::Int8BlockSize;
+
+				if (body_size != sizeof(header) + block_count * sizeof(float) + count)
+					throw std::exception("Invalid quantized array.");
+
+				std::vector<float> scales(block_count);
+				std::memcpy(scales.data(), body + sizeof(header), block_count * sizeof(float));
+				const auto int8_values = reinterpret_cast<const std::int8_t*>(body + sizeof(header) + block_count * sizeof(float));
+
+				for (auto value_id = 0u; value_id < count; ++value_id)
+					values[value_id] = scales[value_id / CheckpointCompression::Int8BlockSize] * int8_values[value_id];
+			}
+
+			packer.pack_array(count);
+
+			for (const auto value : values)
+			{
+				if (header.is_double)
+					packer.pack_double(value);
+				else
+					packer.pack_float(value);
+			}
+		}
+
+		/// <summary>
+		/// Packs the given object replacing its floating point arrays with the quantized ones.
+		/// </summary>
+		void pack_quantized(const msgpack::object& obj, const WeightPrecision precision, Packer& packer)
+		{
+			if (is_float_array(obj))
+				pack_quantized_array(obj, precision, packer);
+			else if (obj.type == msgpack::type::ARRAY)
+			{
+				packer.pack_array(obj.via.array.size);
+
+				for (auto item_id = 0u; item_id < obj.via.array.size; ++item_id)
+					pack_quantized(obj.via.array.ptr[item_id], precision, packer);
+			} else if (obj.type == msgpack::type::MAP)
+			{
+				packer.pack_map(obj.via.map.size);
+
+				for (auto item_id = 0u; item_id < obj.via.map.size; ++item_id)
+				{
+					pack_quantized(obj.via.map.ptr[item_id].key, precision, packer);
+					pack_quantized(obj.via.map.ptr[item_id].val, precision, packer);
+				}
+			} else
+				packer.pack(obj);
+		}
+
+		/// <summary>
+		/// Packs the given object replacing its quantized arrays with the floating point ones.
+		/// </summary>
+		void pack_dequantized(const msgpack::object& obj, Packer& packer)
+		{
+			if (obj.type == msgpack::type::EXT &&
+				(obj.via.ext.type() == HalfArrayExtType || obj.via.ext.type() == Int8ArrayExtType))
+				pack_dequantized_array(obj, packer);
+			else if (obj.type == msgpack::type::ARRAY)
+			{
+				packer.pack_array(obj.via.array.size);
+
+				for (auto item_id = 0u; item_id < obj.via.array.size; ++item_id)
+					pack_dequantized(obj.via.array.ptr[item_id], packer);
+			} else if (obj.type == msgpack::type::MAP)
+			{
+				packer.pack_map(obj.via.map.size);
+
+				for (auto item_id = 0u; item_id < obj.via.map.size; ++item_id)
+				{
+					pack_dequantized(obj.via.map.ptr[item_id].key, packer);
+					pack_dequantized(obj.via.map.ptr[item_id].val, packer);
+				}
+			} else
+				packer.pack(obj);
+		}
+
+		std::vector<char> to_vector(const msgpack::sbuffer& buffer)
+		{
+			return { buffer.data(), buffer.data() + buffer.size() };
+		}
+	}
+
+	std::vector<char> CheckpointCompression::compress(const char* data, const std::size_t size, const WeightPrecision precision)
+	{
+		if (precision != WeightPrecision::Half && precision != WeightPrecision::Int8)
+			throw std::exception("Unsupported precision of weights.");
+
+		const auto handle = msgpack::unpack(data, size);
+		msgpack::sbuffer buffer;
+		Packer packer(buffer);
+		pack_quantized(handle.get(), precision, packer);
+
+		return to_vector(buffer);
+	}
+
+	std::vector<char> CheckpointCompression::decompress(const char* data, const std::size_t size)
+	{
+		const auto handle = msgpack::unpack(data, size);
+		msgpack::sbuffer buffer;
+		Packer packer(buffer);
+		pack_dequantized(handle.get(), packer);
+
+		return to_vector(buffer);
+	}
+}
@@ -0,0 +1,62 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+#include <cstddef>
+#include <vector>
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// Precision the weights are stored with in a checkpoint file (values are part of the interface of the DLL
+	/// and the format of saved nets and must not be changed).
+	/// </summary>
+	enum class WeightPrecision : int
+	{
+		Full = 0,
+		Half = 1,
+		Int8 = 2,
+	};
+
+	/// <summary>
+	/// Lossy compression of checkpoint files: each array of floating point values of a serialized (msgpack) net
+	/// is replaced with a msgpack extension holding its half precision or 8-bit quantized version.
+	/// It affects the size of the file only: the weights are expanded back to "Real" when the net is loaded,
+	/// so neither the resident memory nor the evaluation kernels of the net change.
+	/// Relies on the DeepLearning library serializing the data of each tensor as a plain array of floating point
+	/// values; any other floating point array of the serialized net is compressed as well.
+	/// </summary>
+	struct CheckpointCompression
+	{
+		/// <summary>
+		/// Number of consecutive values sharing a scale factor in the 8-bit representation.
+		/// </summary>
+		static constexpr int Int8BlockSize = 64;
+
+		/// <summary>
+		/// Returns msgpack data equivalent to the given one (<paramref name="size"/> bytes starting at
+		/// <paramref name="data"/>) with all the floating point arrays stored with the given <paramref name="precision"/>.
+		/// </summary>
+		static std::vector<char> compress(const char* data, const std::size_t size, const WeightPrecision precision);
+
+		/// <summary>
+		/// Returns msgpack data with all the compressed arrays of the given data (see "compress")
+		/// expanded back to the floating point arrays.
+		/// </summary>
+		static std::vector<char> decompress(const char* data, const std::size_t size);
+	};
+}
@@ -16,38 +16,352 @@
 //SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "DataConversionUtils.h"
+#include "SimdLevel.h"
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <immintrin.h>
+#include <intrin.h>
 
 namespace BAnalyzerNative
 {
-	void DataConversionUtils::fill_lazy_vector(const long long item_size, const double* arr,
+	namespace
+	{
+		/// <summary>
+		/// Returns "true" if the half precision conversion instructions (F16C) are supported by both the CPU and the OS.
+		/// </summary>
+		bool detect_f16c()
+		{
+			int regs[4]{};
+			__cpuid(regs, 1);
+			const auto os_uses_xsave = (regs[2] & (1 << 27)) != 0;
+			const auto cpu_has_avx = (regs[2] & (1 << 28)) != 0;
+			const auto cpu_has_f16c = (regs[2] & (1 << 29)) != 0;
+
+			return os_uses_xsave && cpu_has_avx && cpu_has_f16c && (_xgetbv(0) & 0x06) == 0x06;
+		}
+
+		/// <summary>
+		/// Returns "true" if the half precision conversion kernels can use F16C instructions (detected once).
+		/// </summary>
+		bool has_f16c()
+		{
+			static const auto result = detect_f16c();
+			return result;
+		}
+
+		void narrow_scalar(const double* src, const long long size, float* dest)
+		{
+			for (auto i = 0ll; i < size; ++i)
+				dest[i] = static_cast<float>(src[i]);
+		}
+
+		void widen_scalar(const float* src, const long long size, double* dest)
+		{
+			for (auto i = 0ll; i < size; ++i)
+				dest[i] = static_cast<double>(src[i]);
+		}
+
+		void narrow_sse2(const double* src, const long long size, float* dest)
+		{
+			const auto vector_size = size & ~3ll;
+			for (auto i = 0ll; i < vector_size; i += 4)
+			{
+				const auto low = _mm_cvtpd_ps(_mm_loadu_pd(src + i));
+				const auto high = _mm_cvtpd_ps(_mm_loadu_pd(src + i + 2));
+				_mm_storeu_ps(dest + i, _mm_movelh_ps(low, high));
+			}
+
+			narrow_scalar(src + vector_size, size - vector_size, dest + vector_size);
+		}
+
+		void widen_sse2(const float* src, const long long size, double* dest)
+		{
+			const auto vector_size = size & ~3ll;
+			for (auto i = 0ll; i < vector_size; i += 4)
+			{
+				const auto values = _mm_loadu_ps(src + i);
+				_mm_storeu_pd(dest + i, _mm_cvtps_pd(values));
+				_mm_storeu_pd(dest + i + 2, _mm_cvtps_pd(_mm_movehl_ps(values, values)));
+			}
+
+			widen_scalar(src + vector_size, size - vector_size, dest + vector_size);
+		}
+
+		void narrow_avx2(const double* src, const long long size, float* dest)
+		{
+			const auto vector_size = size & ~7ll;
+			for (auto i = 0ll; i < vector_size; i += 8)
+			{
+				_mm_storeu_ps(dest + i, _mm256_cvtpd_ps(_mm256_loadu_pd(src + i)));
+				_mm_storeu_ps(dest + i + 4, _mm256_cvtpd_ps(_mm256_loadu_pd(src + i + 4)));
+			}
+
+			narrow_sse2(src + vector_size, size - vector_size, dest + vector_size);
+		}
+
+		void widen_avx2(const float* src, const long long size, double* dest)
+		{
+			const auto vector_size = size & ~7ll;
+			for (auto i = 0ll; i < vector_size; i += 8)
+			{
+				_mm256_storeu_pd(dest + i, _mm256_cvtps_pd(_mm_loadu_ps(src + i)));
+				_mm256_storeu_pd(dest + i + 4, _mm256_cvtps_pd(_mm_loadu_ps(src + i + 4)));
+			}
+
+			widen_sse2(src + vector_size, size - vector_size, dest + vector_size);
+		}
+
+		void narrow_avx512(const double* src, const long long size, float* dest)
+		{
+			const auto vector_size = size & ~15ll;
+			for (auto i = 0ll; i < vector_size; i += 16)
+			{
+				_mm256_storeu_ps(dest + i, _mm512_cvtpd_ps(_mm512_loadu_pd(src + i)));
+				_mm256_storeu_ps(dest + i + 8, _mm512_cvtpd_ps(_mm512_loadu_pd(src + i + 8)));
+			}
+
+			narrow_avx2(src + vector_size, size - vector_size, dest + vector_size);
+		}
+
+		void widen_avx512(const float* src, const long long size, double* dest)
+		{
+			const auto vector_size = size & ~15ll;
+			for (auto i = 0ll; i < vector_size; i += 16)
+			{
+				_mm512_storeu_pd(dest + i, _mm512_cvtps_pd(_mm256_loadu_ps(src + i)));
+				_mm512_storeu_pd(dest + i + 8, _mm512_cvtps_pd(_mm256_loadu_ps(src + i + 8)));
+			}
+
+			widen_avx2(src + vector_size, size - vector_size, dest + vector_size);
+		}
+
+		std::uint16_t to_half_scalar(const float value)
+		{
+			std::uint32_t bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			const auto sign = static_cast<std::uint16_t>((bits >> 16) & 0x8000);
+			bits &= 0x7FFFFFFF;
+
+			if (bits >= 0x7F800000) // infinity or NaN
+				return sign | 0x7C00 | (bits > 0x7F800000 ? 0x0200 : 0);
+
+			if (bits >= 0x477FF000) // rounds to a value beyond the range of half precision
+				return sign | 0x7C00;
+
+			std::uint32_t result;
+			std::uint32_t remainder;
+			std::uint32_t halfway;
+
+			if (bits < 0x38800000) // subnormal in half precision
+			{
+				if (bits < 0x33000000)
+					return sign;
+
+				const auto shift = 126 - (bits >> 23);
+				const auto mantissa = (bits & 0x7FFFFF) | 0x800000;
+				result = mantissa >> shift;
+				remainder = mantissa & ((1u << shift) - 1);
+				halfway = 1u << (shift - 1);
+			} else
+			{
+				const auto rebiased = bits - 0x38000000;
+				result = rebiased >> 13;
+				remainder = rebiased & 0x1FFF;
+				halfway = 0x1000;
+			}
+
+			if (remainder > halfway || (remainder == halfway && (result & 1)))
+				++result;
+
+			return sign | static_cast<std::uint16_t>(result);
+		}
+
+		float from_half_scalar(const std::uint16_t value)
+		{
+			const auto sign = static_cast<std::uint32_t>(value & 0x8000) << 16;
+			auto exponent = static_cast<std::uint32_t>(value >> 10) & 0x1F;
+			auto mantissa = static_cast<std::uint32_t>(value) & 0x3FF;
+			std::uint32_t bits;
+
+			if (exponent == 0x1F)
+				bits = sign | 0x7F800000 | (mantissa << 13);
+			else if (exponent != 0)
+				bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+			else if (mantissa == 0)
+				bits = sign;
+			else
+			{
+				// Subnormal in half precision, but normal in single precision.
+				exponent = 113;
+				while ((mantissa & 0x400) == 0)
+				{
+					mantissa <<= 1;
+					--exponent;
+				}
+
+				bits = sign | (exponent << 23) | ((mantissa & 0x3FF) << 13);
+			}
+
+			float result;
+			std::memcpy(&result, &bits, sizeof(result));
+			return result;
+		}
+
+		void to_half_scalar(const float* src, const long long size, std::uint16_t* dest)
+		{
+			for (auto i = 0ll; i < size; ++i)
+				dest[i] = to_half_scalar(src[i]);
+		}
+
+		void from_half_scalar(const std::uint16_t* src, const long long size, float* dest)
+		{
+			for (auto i = 0ll; i < size; ++i)
+				dest[i] = from_half_scalar(src[i]);
+		}
+
+		void to_half_f16c(const float* src, const long long size, std::uint16_t* dest)
+		{
+			const auto vector_size = size & ~7ll;
+			for (auto i = 0ll; i < vector_size; i += 8)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i),
+					_mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+
+			to_half_scalar(src + vector_size, size - vector_size, dest + vector_size);
+		}
+
+		void from_half_f16c(const std::uint16_t* src, const long long size, float* dest)
+		{
+			const auto vector_size = size & ~7ll;
+			for (auto i = 0ll; i < vector_size; i += 8)
+				_mm256_storeu_ps(dest + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+
+			from_half_scalar(src + vector_size, size - vector_size, dest + vector_size);
+		}
+
+		/// <summary>
+		/// Copies <paramref name="size"/> elements of <paramref name="src"/> to <paramref name="dest"/>.
+		/// </summary>
+		template <class S, class D>
+		void copy(const S* src, const long long size, D* dest)
+		{
+			if constexpr (std::is_same_v<S, D>)
+				std::memcpy(dest, src, size * sizeof(S));
+			else
+				DataConversionUtils::convert(src, size, dest);
+		}
+	}
+
+	void DataConversionUtils::convert(const double* src, const long long size, float* dest)
+	{
+		switch (simd_level())
+		{
+		case SimdLevel::AVX512: narrow_avx512(src, size, dest); break;
+		case SimdLevel::AVX2: narrow_avx2(src, size, dest); break;
+		default: narrow_sse2(src, size, dest); break;
+		}
+	}
+
+	void DataConversionUtils::convert(const float* src, const long long size, double* dest)
+	{
+		switch (simd_level())
+		{
+		case SimdLevel::AVX512: widen_avx512(src, size, dest); break;
+		case SimdLevel::AVX2: widen_avx2(src, size, dest); break;
+		default: widen_sse2(src, size, dest); break;
+		}
+	}
+
+	void DataConversionUtils::to_half(const float* src, const long long size, std::uint16_t* dest)
+	{
+		if (has_f16c())
+			to_half_f16c(src, size, dest);
+		else
+			to_half_scalar(src, size, dest);
+	}
+
+	void DataConversionUtils::from_half(const std::uint16_t* src, const long long size, float* dest)
+	{
+		if (has_f16c())
+			from_half_f16c(src, size, dest);
+		else
+			from_half_scalar(src, size, dest);
+	}
+
+	template <class T>
+	void DataConversionUtils::to_real(const T* src, const long long size, DeepLearning::Real* dest)
+	{
+		copy(src, size, dest);
+	}
+
+	template <class T>
+	void DataConversionUtils::from_real(const DeepLearning::Real* src, const long long size, T* dest)
+	{
+		copy(src, size, dest);
+	}
+
+	template <class T>
+	bool DataConversionUtils::fill_tensor(const long long item_size, const T* arr,
+		DeepLearning::CpuDC::tensor_t& dest)
+	{
+		// Tensors are reused between calls, so most of the time they already have the proper size.
+		const auto resize_needed = static_cast<long long>(dest.size()) != item_size;
+
+		if (resize_needed)
+			dest.resize(1, 1, item_size);
+
+		to_real(arr, item_size, dest.begin());
+
+		return resize_needed;
+	}
+
+	template <class T>
+	void DataConversionUtils::pack_tensor(const DeepLearning::CpuDC::tensor_t& src, T* dest)
+	{
+		from_real(src.begin(), static_cast<long long>(src.size()), dest);
+	}
+
+	template <class T>
+	int DataConversionUtils::fill_lazy_vector(const long long item_size, const T* arr,
 		DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t>& dest)
 	{
+		auto resized_count = 0;
 		auto begin = arr;
 		for (auto item_id = 0ull; item_id < dest.size(); ++item_id)
 		{
-			dest[item_id].resize(1, 1, item_size);
-
-			const auto end = begin + item_size;
-#ifdef USE_SINGLE_PRECISION
-#pragma warning(push)
-#pragma warning(disable: 4244)
-#endif
-			std::ranges::copy(begin, end, dest[item_id].begin());
-#ifdef USE_SINGLE_PRECISION
-#pragma warning(pop)
-#endif
-			begin = end;
+			resized_count += fill_tensor(item_size, begin, dest[item_id]) ? 1 : 0;
+			begin += item_size;
 		}
+
+		return resized_count;
 	}
 
+	template <class T>
 	void DataConversionUtils::pack_lazy_vector(const DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t>& src,
-		double* dest)
+		T* dest)
 	{
 		auto begin = dest;
 		for (const auto& item : src)
 		{
-			std::ranges::copy(item, begin);
+			pack_tensor(item, begin);
 			begin += item.size();
 		}
 	}
+
+	template void DataConversionUtils::to_real(const double*, const long long, DeepLearning::Real*);
+	template void DataConversionUtils::to_real(const float*, const long long, DeepLearning::Real*);
+	template void DataConversionUtils::from_real(const DeepLearning::Real*, const long long, double*);
+	template void DataConversionUtils::from_real(const DeepLearning::Real*, const long long, float*);
+	template bool DataConversionUtils::fill_tensor(const long long, const double*, DeepLearning::CpuDC::tensor_t&);
+	template bool DataConversionUtils::fill_tensor(const long long, const float*, DeepLearning::CpuDC::tensor_t&);
+	template void DataConversionUtils::pack_tensor(const DeepLearning::CpuDC::tensor_t&, double*);
+	template void DataConversionUtils::pack_tensor(const DeepLearning::CpuDC::tensor_t&, float*);
+	template int DataConversionUtils::fill_lazy_vector(const long long, const double*,
+		DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t>&);
+	template int DataConversionUtils::fill_lazy_vector(const long long, const float*,
+		DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t>&);
+	template void DataConversionUtils::pack_lazy_vector(const DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t>&,
+		double*);
+	template void DataConversionUtils::pack_lazy_vector(const DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t>&,
+		float*);
 }
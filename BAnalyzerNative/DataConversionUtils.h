@@ -20,6 +20,7 @@
 #include <defs.h>
 #include <NeuralNet/LazyVector.h>
 #include <NeuralNet/DataContext.h>
+#include <cstdint>
 
 namespace BAnalyzerNative
 {
@@ -28,15 +29,75 @@ namespace BAnalyzerNative
 	/// </summary>
 	struct DataConversionUtils
 	{
+		/// <summary>
+		/// Converts <paramref name="size"/> elements of <paramref name="src"/> to single precision and stores them
+		/// into <paramref name="dest"/>. Uses the widest SIMD instruction set (AVX-512, AVX2 or SSE2) available at run-time.
+		/// </summary>
+		static void convert(const double* src, const long long size, float* dest);
+
+		/// <summary>
+		/// Converts <paramref name="size"/> elements of <paramref name="src"/> to double precision and stores them
+		/// into <paramref name="dest"/>. Uses the widest SIMD instruction set (AVX-512, AVX2 or SSE2) available at run-time.
+		/// </summary>
+		static void convert(const float* src, const long long size, double* dest);
+
+		/// <summary>
+		/// Converts <paramref name="size"/> elements of <paramref name="src"/> to half precision (IEEE 754 "binary16",
+		/// rounded to the nearest even) and stores them into <paramref name="dest"/>. Uses F16C instructions if available at run-time.
+		/// </summary>
+		static void to_half(const float* src, const long long size, std::uint16_t* dest);
+
+		/// <summary>
+		/// Converts <paramref name="size"/> half precision (IEEE 754 "binary16") elements of <paramref name="src"/> to
+		/// single precision and stores them into <paramref name="dest"/>. Uses F16C instructions if available at run-time.
+		/// </summary>
+		static void from_half(const std::uint16_t* src, const long long size, float* dest);
+
+		/// <summary>
+		/// Copies <paramref name="size"/> elements of <paramref name="src"/> to <paramref name="dest"/>.
+		/// A plain memory copy if the types coincide, SIMD conversion otherwise.
+		/// </summary>
+		/// <typeparam name="T">Type of the source elements ("double" or "float").</typeparam>
+		template <class T>
+		static void to_real(const T* src, const long long size, DeepLearning::Real* dest);
+
+		/// <summary>
+		/// Copies <paramref name="size"/> elements of <paramref name="src"/> to <paramref name="dest"/>.
+		/// A plain memory copy if the types coincide, SIMD conversion otherwise.
+		/// </summary>
+		/// <typeparam name="T">Type of the destination elements ("double" or "float").</typeparam>
+		template <class T>
+		static void from_real(const DeepLearning::Real* src, const long long size, T* dest);
+
+		/// <summary>
+		/// Fills the given tensor <paramref name="dest"/> with the first <paramref name="item_size"/> elements of <paramref name="arr"/>.
+		/// Returns "true" if the tensor had to be resized (i.e., reallocated).
+		/// </summary>
+		/// <typeparam name="T">Type of the plain array elements ("double" or "float").</typeparam>
+		template <class T>
+		static bool fill_tensor(const long long item_size, const T* arr, DeepLearning::CpuDC::tensor_t& dest);
+
+		/// <summary>
+		/// Packs the given tensor <paramref name="src"/> into the given plain array <paramref name="dest"/>.
+		/// </summary>
+		/// <typeparam name="T">Type of the plain array elements ("double" or "float").</typeparam>
+		template <class T>
+		static void pack_tensor(const DeepLearning::CpuDC::tensor_t& src, T* dest);
+
 		/// <summary>
 		/// Fills the given instance <paramref name="dest"/> of lazy vector with the content of <paramref name="arr"/>.
+		/// Returns number of tensors that had to be resized (i.e., reallocated).
 		/// </summary>
-		static void fill_lazy_vector(const long long item_size, const double* arr,
+		/// <typeparam name="T">Type of the plain array elements ("double" or "float").</typeparam>
+		template <class T>
+		static int fill_lazy_vector(const long long item_size, const T* arr,
 			DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t>& dest);
 
 		/// <summary>
 		/// Packs given "lazy vector" <paramref name="src"/> into the given plain array <paramref name="dest"/>.
 		/// </summary>
-		static void pack_lazy_vector(const DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t>& src, double* dest);
+		/// <typeparam name="T">Type of the plain array elements ("double" or "float").</typeparam>
+		template <class T>
+		static void pack_lazy_vector(const DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t>& src, T* dest);
 	};
 }
@@ -0,0 +1,96 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+#include <functional>
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// Parameters of a multi-epoch training job (see RNN::fit).
+	/// The layout is shared with the managed side, so the structure must stay "plain".
+	/// </summary>
+	struct FitOptions
+	{
+		/// <summary>
+		/// Maximal number of passes through the training part of the data set.
+		/// </summary>
+		int epoch_count{ 1 };
+
+		/// <summary>
+		/// Number of training pairs in a mini-batch.
+		/// </summary>
+		int batch_size{ 1 };
+
+		/// <summary>
+		/// Factor determining aggressiveness of the training.
+		/// </summary>
+		double learning_rate{ 0.1 };
+
+		/// <summary>
+		/// Fraction (in [0, 1)) of the data set to be held out for validation. The validation pairs
+		/// are taken from the end of the data set (i.e., they are the "latest" ones for time series data).
+		/// </summary>
+		double validation_fraction{};
+
+		/// <summary>
+		/// Number of consecutive epochs without improvement of the validation cost after which the training stops.
+		/// Non-positive value disables early stopping.
+		/// </summary>
+		int patience{};
+
+		/// <summary>
+		/// Seed of the random generator used to shuffle the training pairs.
+		/// </summary>
+		unsigned int seed{};
+	};
+
+	/// <summary>
+	/// Summary of a multi-epoch training job (see RNN::fit).
+	/// The layout is shared with the managed side, so the structure must stay "plain".
+	/// </summary>
+	struct FitResult
+	{
+		/// <summary>
+		/// Number of performed epochs.
+		/// </summary>
+		int epoch_count{};
+
+		/// <summary>
+		/// Zero-based index of the epoch with the lowest validation cost (or "-1" if there was no validation).
+		/// The weights of this epoch are restored when the training ends.
+		/// </summary>
+		int best_epoch{ -1 };
+
+		/// <summary>
+		/// The lowest validation cost (average per element).
+		/// </summary>
+		double best_validation_cost{};
+
+		/// <summary>
+		/// Validation cost after the last performed epoch (average per element).
+		/// </summary>
+		double last_validation_cost{};
+	};
+
+	/// <summary>
+	/// Observer of a multi-epoch training (see RNN::fit) called after each epoch with the zero-based index of the
+	/// epoch and the cost (average per element) of the net on the validation part of the data set
+	/// (or on the training part if there is no validation).
+	/// </summary>
+	using EpochCallback = std::function<void(const int epoch_id, const double cost)>;
+}
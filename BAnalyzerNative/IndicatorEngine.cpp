@@ -0,0 +1,273 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include "IndicatorEngine.h"
+#include "SeriesKernels.h"
+#include <algorithm>
+#include <cmath>
+
+namespace BAnalyzerNative
+{
+	namespace
+	{
+		/// <summary>
+		/// Number of k-lines processed in one go (the derived columns of a chunk fit into L1 cache).
+		/// </summary>
+		constexpr int ChunkSize = 256;
+
+		/// <summary>
+		/// Returns "true" if the indicator of the given type is computed over a rolling window.
+		/// </summary>
+		bool is_windowed(const IndicatorType type)
+		{
+			return type == IndicatorType::Sma || type == IndicatorType::BollingerUpper ||
+				type == IndicatorType::BollingerLower || type == IndicatorType::Vwap;
+		}
+
+		/// <summary>
+		/// Returns number of k-lines the indicator with the given period is averaged over at the given k-line.
+		/// </summary>
+		double averaging_count(const long long kline_id, const int period)
+		{
+			return static_cast<double>(std::min<long long>(kline_id + 1, period));
+		}
+	}
+
+	IndicatorEngine::IndicatorEngine(const int spec_count, const IndicatorSpec* specs)
+	{
+		if (spec_count <= 0 || !specs)
+			throw std::exception("Invalid indicator definitions.");
+
+		_channels.resize(spec_count);
+
+		for (auto channel_id = 0; channel_id < spec_count; ++channel_id)
+		{
+			const auto& spec = specs[channel_id];
+
+			if (spec.type < IndicatorType::Sma || spec.type > IndicatorType::Atr)
+				throw std::exception("Unknown indicator type.");
+
+			if (spec.period <= 0)
+				throw std::exception("Invalid indicator period.");
+
+			auto& channel = _channels[channel_id];
+			channel.spec = spec;
+
+			if (is_windowed(spec.type))
+			{
+				channel.window.resize(spec.period);
+				channel.window_aux.resize(spec.period);
+			}
+		}
+
+		_gain.resize(ChunkSize);
+		_loss.resize(ChunkSize);
+		_true_range.resize(ChunkSize);
+		_typical_price.resize(ChunkSize);
+	}
+
+	int IndicatorEngine::indicator_count() const
+	{
+		return static_cast<int>(_channels.size());
+	}
+
+	long long IndicatorEngine::kline_count() const
+	{
+		return _kline_count;
+	}
+
+	void IndicatorEngine::compute_derived_columns(const KLineColumns& columns,
+		const int begin_kline_id, const int kline_count)
+	{
+		const auto high = columns.high_price + begin_kline_id;
+		const auto low = columns.low_price + begin_kline_id;
+		const auto close = columns.close_price + begin_kline_id;
+
+		// The very first k-line of the series has no predecessor.
+		const auto prev_close = _kline_count > 0 ? _prev_close : close[0];
+		_gain[0] = std::max(close[0] - prev_close, 0.0);
+		_loss[0] = std::max(prev_close - close[0], 0.0);
+		_true_range[0] = std::max({ high[0] - low[0], std::abs(high[0] - prev_close), std::abs(low[0] - prev_close) });
+
+		SeriesKernels::gain_loss(close, close + 1, kline_count - 1, _gain.data() + 1, _loss.data() + 1);
+		SeriesKernels::true_range(high + 1, low + 1, close, kline_count - 1, _true_range.data() + 1);
+		SeriesKernels::typical_price(high, low, close, kline_count, _typical_price.data());
+	}
+
+	void IndicatorEngine::advance(Channel& channel, const KLineColumns& columns,
+		const int begin_kline_id, const int kline_count, double* output) const
+	{
+		const auto period = channel.spec.period;
+		const auto close = columns.close_price + begin_kline_id;
+		const auto volume = columns.volume + begin_kline_id;
+		const auto stride = indicator_count();
+
+		// Pushes the given values into the circular buffers of the channel.
+		const auto push = [&channel, period](const double value, const double value_aux, const long long kline_id)
+		{
+			auto& pos = channel.window_pos;
+
+			if (kline_id >= period)
+			{
+				channel.sum -= channel.window[pos];
+				channel.sum_aux -= channel.window_aux[pos];
+			}
+
+			channel.window[pos] = value;
+			channel.window_aux[pos] = value_aux;
+			channel.sum += value;
+			channel.sum_aux += value_aux;
+
+			if (++pos == period)
+			{
+				// Recalculate the sums from scratch once per period,
+				// so that the rounding errors do not accumulate over long series.
+				pos = 0;
+				channel.sum = 0.0;
+				channel.sum_aux = 0.0;
+
+				for (auto i = 0; i < period; ++i)
+				{
+					channel.sum += channel.window[i];
+					channel.sum_aux += channel.window_aux[i];
+				}
+			}
+		};
+
+		switch (channel.spec.type)
+		{
+		case IndicatorType::Sma:
+			for (auto t = 0; t < kline_count; ++t)
+			{
+				const auto kline_id = _kline_count + t;
+				push(close[t], 0.0, kline_id);
+				output[t * stride] = channel.sum / averaging_count(kline_id, period);
+			}
+			break;
+		case IndicatorType::BollingerUpper:
+		case IndicatorType::BollingerLower:
+		{
+			const auto factor = channel.spec.type == IndicatorType::BollingerUpper ?
+				channel.spec.factor : -channel.spec.factor;
+
+			for (auto t = 0; t < kline_count; ++t)
+			{
+				const auto kline_id = _kline_count + t;
+				push(close[t], close[t] * close[t], kline_id);
+				const auto n = averaging_count(kline_id, period);
+				const auto mean = channel.sum / n;
+				const auto variance = std::max(channel.sum_aux / n - mean * mean, 0.0);
+				output[t * stride] = mean + factor * std::sqrt(variance);
+			}
+			break;
+		}
+		case IndicatorType::Vwap:
+			for (auto t = 0; t < kline_count; ++t)
+			{
+				const auto safe_volume = std::max(volume[t], 0.0);
+				push(_typical_price[t] * safe_volume, safe_volume, _kline_count + t);
+				output[t * stride] = channel.sum_aux > 0 ? channel.sum / channel.sum_aux : _typical_price[t];
+			}
+			break;
+		case IndicatorType::Ema:
+		{
+			const auto alpha = 2.0 / (period + 1);
+
+			for (auto t = 0; t < kline_count; ++t)
+			{
+				// Running mean until it becomes "heavier" than the exponential weight
+				// (the very first k-line initializes the average).
+				const auto weight = std::max(alpha, 1.0 / static_cast<double>(_kline_count + t + 1));
+				channel.average += weight * (close[t] - channel.average);
+				output[t * stride] = channel.average;
+			}
+			break;
+		}
+		case IndicatorType::Rsi:
+			for (auto t = 0; t < kline_count; ++t)
+			{
+				// The first k-line of the series has no price change, so it is skipped.
+				if (const auto change_count = _kline_count + t; change_count > 0)
+				{
+					const auto weight = 1.0 / static_cast<double>(std::min<long long>(change_count, period));
+					channel.average += weight * (_gain[t] - channel.average);
+					channel.average_aux += weight * (_loss[t] - channel.average_aux);
+				}
+
+				const auto total = channel.average + channel.average_aux;
+				output[t * stride] = total > 0 ? 100.0 * channel.average / total : 50.0;
+			}
+			break;
+		case IndicatorType::Atr:
+			for (auto t = 0; t < kline_count; ++t)
+			{
+				const auto weight = 1.0 / averaging_count(_kline_count + t, period);
+				channel.average += weight * (_true_range[t] - channel.average);
+				output[t * stride] = channel.average;
+			}
+			break;
+		default:
+			throw std::exception("Unknown indicator type.");
+		}
+	}
+
+	int IndicatorEngine::update(const KLineColumns& columns, const int output_capacity, double* output)
+	{
+		if (columns.count <= 0 || !columns.high_price || !columns.low_price ||
+			!columns.close_price || !columns.volume)
+			throw std::exception("Invalid k-line data.");
+
+		const auto stride = indicator_count();
+		const auto output_count = static_cast<long long>(columns.count) * stride;
+
+		if (!output || output_capacity < output_count)
+			throw std::exception("Insufficient output capacity.");
+
+		// The series is processed chunk by chunk: all the indicators are advanced through
+		// a chunk while its derived columns are "hot", so the data is effectively read once.
+		for (auto begin_kline_id = 0; begin_kline_id < columns.count; begin_kline_id += ChunkSize)
+		{
+			const auto chunk_size = std::min(ChunkSize, columns.count - begin_kline_id);
+			compute_derived_columns(columns, begin_kline_id, chunk_size);
+			const auto chunk_output = output + static_cast<std::size_t>(begin_kline_id) * stride;
+
+			for (auto channel_id = 0; channel_id < stride; ++channel_id)
+				advance(_channels[channel_id], columns, begin_kline_id, chunk_size, chunk_output + channel_id);
+
+			_kline_count += chunk_size;
+			_prev_close = columns.close_price[begin_kline_id + chunk_size - 1];
+		}
+
+		return static_cast<int>(output_count);
+	}
+
+	void IndicatorEngine::reset()
+	{
+		for (auto& channel : _channels)
+		{
+			std::ranges::fill(channel.window, 0.0);
+			std::ranges::fill(channel.window_aux, 0.0);
+			channel.window_pos = 0;
+			channel.sum = 0.0;
+			channel.sum_aux = 0.0;
+			channel.average = 0.0;
+			channel.average_aux = 0.0;
+		}
+
+		_kline_count = 0;
+		_prev_close = 0.0;
+	}
+}
@@ -0,0 +1,186 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#pragma once
+#include "KLineFeatures.h"
+#include <vector>
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// Types of technical indicators (the values are shared with the managed side).
+	/// </summary>
+	enum class IndicatorType : int
+	{
+		/// <summary>
+		/// Simple moving average of the close price.
+		/// </summary>
+		Sma = 0,
+
+		/// <summary>
+		/// Exponential moving average of the close price.
+		/// </summary>
+		Ema = 1,
+
+		/// <summary>
+		/// Relative strength index (Wilder's smoothing), in [0, 100].
+		/// </summary>
+		Rsi = 2,
+
+		/// <summary>
+		/// Simple moving average of the close price plus "factor" standard deviations.
+		/// </summary>
+		BollingerUpper = 3,
+
+		/// <summary>
+		/// Simple moving average of the close price minus "factor" standard deviations.
+		/// </summary>
+		BollingerLower = 4,
+
+		/// <summary>
+		/// Volume weighted average of the typical ((high + low + close) / 3) price over a rolling window.
+		/// </summary>
+		Vwap = 5,
+
+		/// <summary>
+		/// Average true range (Wilder's smoothing).
+		/// </summary>
+		Atr = 6,
+	};
+
+	/// <summary>
+	/// Definition of an indicator to be computed by "IndicatorEngine".
+	/// The layout is shared with the managed side, so the structure must stay "plain".
+	/// </summary>
+	struct IndicatorSpec
+	{
+		/// <summary>
+		/// Type of the indicator.
+		/// </summary>
+		IndicatorType type{};
+
+		/// <summary>
+		/// Number of k-lines the indicator is averaged over.
+		/// </summary>
+		int period{};
+
+		/// <summary>
+		/// Width of the Bollinger bands in standard deviations (ignored by the other indicators).
+		/// </summary>
+		double factor{};
+	};
+
+	/// <summary>
+	/// Computes a set of technical indicators of a series of k-lines in a single pass over the data.
+	/// The state of the indicators is kept between the calls, so the series can be fed incrementally
+	/// (e.g., one k-line at a time) and yields the same result as if it was fed at once.
+	/// Until enough k-lines are seen, the indicators are averaged over all the available ones.
+	/// The class is not thread-safe: use an instance per series (symbol).
+	/// </summary>
+	class IndicatorEngine
+	{
+		/// <summary>
+		/// State of a single indicator.
+		/// </summary>
+		struct Channel
+		{
+			IndicatorSpec spec{};
+
+			/// <summary>
+			/// Circular buffers of the last "period" primary and secondary
+			/// values of the indicators computed over a rolling window.
+			/// </summary>
+			std::vector<double> window;
+			std::vector<double> window_aux;
+			int window_pos{};
+
+			/// <summary>
+			/// Sums of the values in the circular buffers.
+			/// </summary>
+			double sum{};
+			double sum_aux{};
+
+			/// <summary>
+			/// Running averages of the recursive indicators.
+			/// </summary>
+			double average{};
+			double average_aux{};
+		};
+
+		std::vector<Channel> _channels;
+
+		/// <summary>
+		/// Number of k-lines processed so far.
+		/// </summary>
+		long long _kline_count{};
+
+		/// <summary>
+		/// Close price of the last processed k-line.
+		/// </summary>
+		double _prev_close{};
+
+		/// <summary>
+		/// Columns derived from the k-lines of the current chunk.
+		/// </summary>
+		std::vector<double> _gain;
+		std::vector<double> _loss;
+		std::vector<double> _true_range;
+		std::vector<double> _typical_price;
+
+		/// <summary>
+		/// Fills the derived columns with the data of the given number of k-lines starting at the given one.
+		/// </summary>
+		void compute_derived_columns(const KLineColumns& columns, const int begin_kline_id, const int kline_count);
+
+		/// <summary>
+		/// Advances the given indicator through the given number of k-lines starting at the given one
+		/// and writes its values into every "indicator_count()"-th element of <paramref name="output"/>.
+		/// </summary>
+		void advance(Channel& channel, const KLineColumns& columns,
+			const int begin_kline_id, const int kline_count, double* output) const;
+
+	public:
+
+		/// <summary>
+		/// Constructor.
+		/// </summary>
+		/// <param name="spec_count">Number of indicators.</param>
+		/// <param name="specs">Definitions of the indicators.</param>
+		IndicatorEngine(const int spec_count, const IndicatorSpec* specs);
+
+		/// <summary>
+		/// Number of indicators computed per k-line.
+		/// </summary>
+		int indicator_count() const;
+
+		/// <summary>
+		/// Number of k-lines processed since construction (or the last reset).
+		/// </summary>
+		long long kline_count() const;
+
+		/// <summary>
+		/// Processes the given next k-lines of the series (only high, low, close prices and volumes are used)
+		/// and writes values of the indicators into <paramref name="output"/> in the time-major order
+		/// ("indicator_count()" consecutive values per k-line). Returns number of the written elements.
+		/// </summary>
+		int update(const KLineColumns& columns, const int output_capacity, double* output);
+
+		/// <summary>
+		/// Discards the state of all the indicators.
+		/// </summary>
+		void reset();
+	};
+}
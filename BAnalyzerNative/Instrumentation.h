@@ -0,0 +1,144 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+#include <atomic>
+#include <chrono>
+
+/// <summary>
+/// Compile-time switch of the hot-path instrumentation (define as "0" to compile it out completely).
+/// </summary>
+#ifndef BANALYZER_INSTRUMENTATION
+#define BANALYZER_INSTRUMENTATION 1
+#endif
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// Plain snapshot of the instrumentation counters (times are in nanoseconds). The "allocation_count" counts
+	/// (re)allocations of the buffers owned by the net only, not the ones made inside the layers of the net.
+	/// </summary>
+	struct RnnStats
+	{
+		long long evaluate_call_count;
+		long long evaluated_item_count;
+		long long train_batch_count;
+		long long trained_pair_count;
+		long long converted_byte_count;
+		long long allocation_count;
+		long long conversion_time_ns;
+		long long forward_time_ns;
+		long long learn_time_ns;
+		long long gradient_time_ns;
+		long long update_time_ns;
+		long long callback_time_ns;
+	};
+
+	/// <summary>
+	/// Thread-safe counters of the hot-path instrumentation.
+	/// All the updates are "relaxed" atomic additions, so the counters do not introduce any synchronization.
+	/// </summary>
+	struct Instrumentation
+	{
+		std::atomic<long long> evaluate_call_count{};
+		std::atomic<long long> evaluated_item_count{};
+		std::atomic<long long> train_batch_count{};
+		std::atomic<long long> trained_pair_count{};
+		std::atomic<long long> converted_byte_count{};
+		std::atomic<long long> allocation_count{};
+		std::atomic<long long> conversion_time_ns{};
+		std::atomic<long long> forward_time_ns{};
+		std::atomic<long long> learn_time_ns{};
+		std::atomic<long long> gradient_time_ns{};
+		std::atomic<long long> update_time_ns{};
+		std::atomic<long long> callback_time_ns{};
+
+		/// <summary>
+		/// Returns snapshot of the counters.
+		/// </summary>
+		RnnStats snapshot() const
+		{
+			constexpr auto order = std::memory_order_relaxed;
+
+			return { evaluate_call_count.load(order), evaluated_item_count.load(order),
+				train_batch_count.load(order), trained_pair_count.load(order),
+				converted_byte_count.load(order), allocation_count.load(order),
+				conversion_time_ns.load(order), forward_time_ns.load(order), learn_time_ns.load(order),
+				gradient_time_ns.load(order), update_time_ns.load(order), callback_time_ns.load(order) };
+		}
+
+		/// <summary>
+		/// Sets all the counters to zero.
+		/// </summary>
+		void reset()
+		{
+			for (auto counter : { &evaluate_call_count, &evaluated_item_count, &train_batch_count, &trained_pair_count,
+				&converted_byte_count, &allocation_count, &conversion_time_ns, &forward_time_ns, &learn_time_ns,
+				&gradient_time_ns, &update_time_ns, &callback_time_ns })
+				counter->store(0, std::memory_order_relaxed);
+		}
+	};
+
+	/// <summary>
+	/// Adds time elapsed between its construction and destruction to the given counter.
+	/// </summary>
+	class ScopedTimer
+	{
+		std::atomic<long long>& _counter;
+		const std::chrono::steady_clock::time_point _start;
+
+	public:
+
+		/// <summary>
+		/// Constructor.
+		/// </summary>
+		explicit ScopedTimer(std::atomic<long long>& counter) :
+			_counter(counter), _start(std::chrono::steady_clock::now()) {}
+
+		/// <summary>
+		/// Destructor.
+		/// </summary>
+		~ScopedTimer()
+		{
+			const auto elapsed = std::chrono::steady_clock::now() - _start;
+			_counter.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+				std::memory_order_relaxed);
+		}
+
+		ScopedTimer(const ScopedTimer&) = delete;
+		ScopedTimer& operator=(const ScopedTimer&) = delete;
+	};
+}
+
+#define BANALYZER_CONCAT_IMPL(a, b) a##b
+#define BANALYZER_CONCAT(a, b) BANALYZER_CONCAT_IMPL(a, b)
+
+#if BANALYZER_INSTRUMENTATION
+/// <summary>
+/// Accumulates time spent in the current scope into the given counter.
+/// </summary>
+#define BANALYZER_SCOPED_TIMER(counter) \
+	const ::BAnalyzerNative::ScopedTimer BANALYZER_CONCAT(scoped_timer_, __LINE__)(counter)
+
+/// <summary>
+/// Adds the given value to the given counter.
+/// </summary>
+#define BANALYZER_COUNT(counter, value) (counter).fetch_add(static_cast<long long>(value), std::memory_order_relaxed)
+#else
+#define BANALYZER_SCOPED_TIMER(counter) ((void)0)
+#define BANALYZER_COUNT(counter, value) ((void)0)
+#endif
@@ -0,0 +1,476 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include "KLineArchive.h"
+#include <algorithm>
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+
+namespace BAnalyzerNative
+{
+	namespace
+	{
+		/// <summary>
+		/// Signature of an archive file ("BKLA").
+		/// </summary>
+		constexpr std::uint32_t ArchiveSignature = 0x414C4B42;
+
+		/// <summary>
+		/// Version of the format of archives; to be incremented on any change of the layout.
+		/// </summary>
+		constexpr std::uint32_t ArchiveVersion = 1;
+
+		/// <summary>
+		/// Flag indicating that the columns of an archive are compressed.
+		/// </summary>
+		constexpr std::uint32_t CompressedFlag = 1;
+
+		/// <summary>
+		/// Header of an archive file. It is followed by the index of the blocks and then by the columns.
+		/// </summary>
+		struct ArchiveHeader
+		{
+			std::uint32_t signature;
+			std::uint32_t version;
+			std::uint32_t block_count;
+			std::uint32_t flags;
+		};
+
+		/// <summary>
+		/// Alignment of the columns in the file (so that they can be accessed in place).
+		/// </summary>
+		constexpr std::size_t ColumnAlignment = 8;
+
+		/// <summary>
+		/// Offsets of the fields of "PackedKLine" corresponding to the columns.
+		/// </summary>
+		constexpr std::size_t ColumnFieldOffsets[KLineArchive::ColumnCount] = {
+			offsetof(PackedKLine, open_time), offsetof(PackedKLine, close_time),
+			offsetof(PackedKLine, open_price), offsetof(PackedKLine, high_price),
+			offsetof(PackedKLine, low_price), offsetof(PackedKLine, close_price),
+			offsetof(PackedKLine, volume), offsetof(PackedKLine, quote_volume),
+			offsetof(PackedKLine, taker_buy_base_volume), offsetof(PackedKLine, taker_buy_quote_volume),
+			offsetof(PackedKLine, trade_count) };
+
+		/// <summary>
+		/// Returns size (in bytes) of an element of the given column.
+		/// </summary>
+		std::size_t element_size(const int column_id)
+		{
+			return column_id == static_cast<int>(ArchiveColumn::TradeCount) ? sizeof(std::int32_t) : sizeof(std::uint64_t);
+		}
+
+		/// <summary>
+		/// Returns the given size rounded up to the column alignment.
+		/// </summary>
+		std::size_t align(const std::size_t size)
+		{
+			return (size + ColumnAlignment - 1) / ColumnAlignment * ColumnAlignment;
+		}
+
+		/// <summary>
+		/// Returns "true" if the given column contains time-stamps.
+		/// </summary>
+		bool is_time_column(const int column_id)
+		{
+			return column_id == static_cast<int>(ArchiveColumn::OpenTime) ||
+				column_id == static_cast<int>(ArchiveColumn::CloseTime);
+		}
+
+		std::uint64_t zigzag_encode(const std::int64_t value)
+		{
+			return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+		}
+
+		std::int64_t zigzag_decode(const std::uint64_t value)
+		{
+			return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+		}
+
+		void write_varint(std::uint64_t value, std::vector<char>& dest)
+		{
+			while (value >= 0x80)
+			{
+				dest.push_back(static_cast<char>(value | 0x80));
+				value >>= 7;
+			}
+
+			dest.push_back(static_cast<char>(value));
+		}
+
+		std::uint64_t read_varint(const char*& ptr, const char* end)
+		{
+			std::uint64_t result = 0;
+
+			for (auto shift = 0; shift < 64; shift += 7)
+			{
+				if (ptr == end)
+					throw std::exception("Corrupted column of an archive.");
+
+				const auto byte = static_cast<std::uint8_t>(*ptr++);
+				result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+
+				if (!(byte & 0x80))
+					return result;
+			}
+
+			throw std::exception("Corrupted column of an archive.");
+		}
+
+		/// <summary>
+		/// Appends compressed representation of the given column to <paramref name="dest"/>.
+		/// Time-stamps are encoded with the "delta-of-delta" scheme (regular series take a byte per value),
+		/// trade counts are delta-encoded, in both cases with zigzag variable-length integers.
+		/// Bits of each floating point value are XOR-ed with the ones of the previous value and only
+		/// the non-zero bytes of the result are stored (preceded by a byte with the numbers of the leading
+		/// and trailing zero bytes), so that repeating and slowly changing values take few bytes.
+		/// </summary>
+		void encode_column(const int column_id, const char* raw, const int count, std::vector<char>& dest)
+		{
+			if (column_id == static_cast<int>(ArchiveColumn::TradeCount))
+			{
+				std::int64_t prev = 0;
+
+				for (auto i = 0; i < count; ++i)
+				{
+					std::int32_t value;
+					std::memcpy(&value, raw + i * sizeof(std::int32_t), sizeof(std::int32_t));
+					write_varint(zigzag_encode(value - prev), dest);
+					prev = value;
+				}
+
+				return;
+			}
+
+			std::uint64_t prev = 0;
+			std::uint64_t prev_delta = 0;
+
+			for (auto i = 0; i < count; ++i)
+			{
+				std::uint64_t value;
+				std::memcpy(&value, raw + i * sizeof(std::uint64_t), sizeof(std::uint64_t));
+
+				if (is_time_column(column_id))
+				{
+					// Unsigned arithmetic wraps around, so any input round-trips.
+					const auto delta = value - prev;
+					write_varint(zigzag_encode(static_cast<std::int64_t>(delta - prev_delta)), dest);
+					prev_delta = delta;
+				} else if (const auto x = value ^ prev; x == 0)
+				{
+					dest.push_back(static_cast<char>(8 << 4));
+				} else
+				{
+					const auto leading = std::countl_zero(x) / 8;
+					const auto trailing = std::countr_zero(x) / 8;
+					dest.push_back(static_cast<char>(leading << 4 | trailing));
+
+					for (auto byte_id = trailing; byte_id < 8 - leading; ++byte_id)
+						dest.push_back(static_cast<char>(x >> (8 * byte_id)));
+				}
+
+				prev = value;
+			}
+		}
+
+		/// <summary>
+		/// Decodes the given compressed column (see "encode_column") into <paramref name="raw"/>.
+		/// </summary>
+		void decode_column(const int column_id, const char* data, const std::size_t size, const int count, char* raw)
+		{
+			const auto end = data + size;
+
+			if (column_id == static_cast<int>(ArchiveColumn::TradeCount))
+			{
+				std::int64_t value = 0;
+
+				for (auto i = 0; i < count; ++i)
+				{
+					value += zigzag_decode(read_varint(data, end));
+					const auto value_32 = static_cast<std::int32_t>(value);
+					std::memcpy(raw + i * sizeof(std::int32_t), &value_32, sizeof(std::int32_t));
+				}
+
+				return;
+			}
+
+			std::uint64_t value = 0;
+			std::uint64_t delta = 0;
+
+			for (auto i = 0; i < count; ++i)
+			{
+				if (is_time_column(column_id))
+				{
+					delta += static_cast<std::uint64_t>(zigzag_decode(read_varint(data, end)));
+					value += delta;
+				} else
+				{
+					if (data == end)
+						throw std::exception("Corrupted column of an archive.");
+
+					const auto control = static_cast<std::uint8_t>(*data++);
+					const auto leading = control >> 4;
+					const auto trailing = control & 0x0F;
+
+					if (leading + trailing > 8 || end - data < 8 - leading - trailing)
+						throw std::exception("Corrupted column of an archive.");
+
+					std::uint64_t x = 0;
+
+					for (auto byte_id = trailing; byte_id < 8 - leading; ++byte_id)
+						x |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(*data++)) << (8 * byte_id);
+
+					value ^= x;
+				}
+
+				std::memcpy(raw + i * sizeof(std::uint64_t), &value, sizeof(std::uint64_t));
+			}
+		}
+	}
+
+	KLineArchive::KLineArchive(const std::filesystem::path& file_path) : _file(file_path)
+	{
+		const auto data = static_cast<const char*>(_file.data());
+
+		if (_file.size() < sizeof(ArchiveHeader))
+			throw std::exception("Invalid file of an archive.");
+
+		ArchiveHeader header{};
+		std::memcpy(&header, data, sizeof(ArchiveHeader));
+
+		if (header.signature != ArchiveSignature || header.version != ArchiveVersion)
+			throw std::exception("Unsupported format of the file of an archive.");
+
+		const auto index_size = static_cast<std::size_t>(header.block_count) * sizeof(BlockEntry);
+
+		if (header.block_count > static_cast<std::uint32_t>(INT_MAX) || _file.size() - sizeof(ArchiveHeader) < index_size)
+			throw std::exception("Invalid file of an archive.");
+
+		_block_count = static_cast<int>(header.block_count);
+		_compressed = (header.flags & CompressedFlag) != 0;
+		// The header keeps the index aligned, while the mapped memory is page-aligned.
+		_entries = reinterpret_cast<const BlockEntry*>(data + sizeof(ArchiveHeader));
+
+		for (auto block_id = 0; block_id < _block_count; ++block_id)
+		{
+			const auto& entry = _entries[block_id];
+
+			if (entry.info.kline_count <= 0)
+				throw std::exception("Invalid file of an archive.");
+
+			for (auto column_id = 0; column_id < ColumnCount; ++column_id)
+			{
+				const auto offset = entry.column_offsets[column_id];
+				const auto size = entry.column_sizes[column_id];
+
+				if (offset > _file.size() || size > _file.size() - offset || offset % ColumnAlignment != 0 ||
+					(!_compressed && size != element_size(column_id) * entry.info.kline_count))
+					throw std::exception("Invalid file of an archive.");
+			}
+		}
+
+		if (_compressed)
+			_decoded_blocks.resize(_block_count);
+	}
+
+	void KLineArchive::write(const std::filesystem::path& file_path, const int block_count, const int* block_sizes,
+		const PackedKLine* items, const bool compress)
+	{
+		if (block_count < 0 || (block_count > 0 && (!block_sizes || !items)))
+			throw std::exception("Invalid k-line data.");
+
+		const auto data_offset = sizeof(ArchiveHeader) + static_cast<std::size_t>(block_count) * sizeof(BlockEntry);
+		std::vector<BlockEntry> entries(block_count);
+		std::vector<char> data;
+		std::vector<char> raw;
+		auto block_items = items;
+
+		for (auto block_id = 0; block_id < block_count; ++block_id)
+		{
+			const auto count = block_sizes[block_id];
+
+			if (count <= 0)
+				throw std::exception("Empty blocks can't be archived.");
+
+			for (auto item_id = 1; item_id < count; ++item_id)
+				if (block_items[item_id].open_time < block_items[item_id - 1].open_time)
+					throw std::exception("K-lines must be ordered chronologically.");
+
+			auto& entry = entries[block_id];
+			entry.info = { block_items[0].open_time, block_items[count - 1].close_time, count, 0 };
+
+			for (auto column_id = 0; column_id < ColumnCount; ++column_id)
+			{
+				const auto size = element_size(column_id);
+				raw.resize(size * count);
+
+				for (auto item_id = 0; item_id < count; ++item_id)
+					std::memcpy(raw.data() + item_id * size,
+						reinterpret_cast<const char*>(&block_items[item_id]) + ColumnFieldOffsets[column_id], size);
+
+				data.resize(align(data.size()));
+				const auto column_offset = data.size();
+
+				if (compress)
+					encode_column(column_id, raw.data(), count, data);
+				else
+					data.insert(data.end(), raw.begin(), raw.end());
+
+				entry.column_offsets[column_id] = data_offset + column_offset;
+				entry.column_sizes[column_id] = data.size() - column_offset;
+			}
+
+			block_items += count;
+		}
+
+		const ArchiveHeader header{ ArchiveSignature, ArchiveVersion,
+			static_cast<std::uint32_t>(block_count), compress ? CompressedFlag : 0 };
+
+		std::ofstream file(file_path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+		if (!file)
+			throw std::exception("Can't open the file for writing.");
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(reinterpret_cast<const char*>(entries.data()),
+			static_cast<std::streamsize>(entries.size() * sizeof(BlockEntry)));
+		file.write(data.data(), static_cast<std::streamsize>(data.size()));
+
+		if (!file)
+			throw std::exception("Failed to write the file.");
+	}
+
+	int KLineArchive::block_count() const
+	{
+		return _block_count;
+	}
+
+	bool KLineArchive::is_compressed() const
+	{
+		return _compressed;
+	}
+
+	void KLineArchive::validate_block_id(const int block_id) const
+	{
+		if (block_id < 0 || block_id >= _block_count)
+			throw std::exception("Invalid block identifier.");
+	}
+
+	ArchiveBlockInfo KLineArchive::block_info(const int block_id) const
+	{
+		validate_block_id(block_id);
+
+		return _entries[block_id].info;
+	}
+
+	void KLineArchive::get_columns(const int block_id, const char* (&columns)[ColumnCount]) const
+	{
+		validate_block_id(block_id);
+		const auto& entry = _entries[block_id];
+		const auto data = static_cast<const char*>(_file.data());
+
+		if (!_compressed)
+		{
+			for (auto column_id = 0; column_id < ColumnCount; ++column_id)
+				columns[column_id] = data + entry.column_offsets[column_id];
+
+			return;
+		}
+
+		std::lock_guard lock(_decode_mutex);
+		auto& decoded = _decoded_blocks[block_id];
+		const auto count = entry.info.kline_count;
+
+		if (!decoded)
+		{
+			std::size_t decoded_size = 0;
+
+			for (auto column_id = 0; column_id < ColumnCount; ++column_id)
+				decoded_size += align(element_size(column_id) * count);
+
+			auto buffer = std::make_unique<std::vector<char>>(decoded_size);
+			auto column_ptr = buffer->data();
+
+			for (auto column_id = 0; column_id < ColumnCount; ++column_id)
+			{
+				decode_column(column_id, data + entry.column_offsets[column_id],
+					entry.column_sizes[column_id], count, column_ptr);
+				column_ptr += align(element_size(column_id) * count);
+			}
+
+			decoded = std::move(buffer);
+		}
+
+		auto column_ptr = decoded->data();
+
+		for (auto column_id = 0; column_id < ColumnCount; ++column_id)
+		{
+			columns[column_id] = column_ptr;
+			column_ptr += align(element_size(column_id) * count);
+		}
+	}
+
+	int KLineArchive::read(const int block_id, const int begin_kline_id, const int count, PackedKLine* output) const
+	{
+		const auto kline_count = block_info(block_id).kline_count;
+
+		if (begin_kline_id < 0 || count < 0 || (count > 0 && !output))
+			throw std::exception("Invalid range of k-lines.");
+
+		const auto end_kline_id = static_cast<int>(std::min<long long>(
+			static_cast<long long>(begin_kline_id) + count, kline_count));
+
+		if (begin_kline_id >= end_kline_id)
+			return 0;
+
+		const char* columns[ColumnCount];
+		get_columns(block_id, columns);
+
+		for (auto kline_id = begin_kline_id; kline_id < end_kline_id; ++kline_id)
+		{
+			auto& item = output[kline_id - begin_kline_id];
+			item = {};
+
+			for (auto column_id = 0; column_id < ColumnCount; ++column_id)
+			{
+				const auto size = element_size(column_id);
+				std::memcpy(reinterpret_cast<char*>(&item) + ColumnFieldOffsets[column_id],
+					columns[column_id] + kline_id * size, size);
+			}
+		}
+
+		return end_kline_id - begin_kline_id;
+	}
+
+	KLineColumns KLineArchive::columns(const int block_id) const
+	{
+		const char* columns[ColumnCount];
+		get_columns(block_id, columns);
+
+		const auto column = [&columns](const ArchiveColumn column_id)
+		{
+			return reinterpret_cast<const double*>(columns[static_cast<int>(column_id)]);
+		};
+
+		return { _entries[block_id].info.kline_count, column(ArchiveColumn::OpenPrice),
+			column(ArchiveColumn::HighPrice), column(ArchiveColumn::LowPrice),
+			column(ArchiveColumn::ClosePrice), column(ArchiveColumn::Volume),
+			reinterpret_cast<const int*>(columns[static_cast<int>(ArchiveColumn::TradeCount)]) };
+	}
+}
@@ -0,0 +1,166 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#pragma once
+#include "KLineFeatures.h"
+#include "KLineResampler.h"
+#include "MappedFile.h"
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// Columns of a block of an archive (one per field of "PackedKLine").
+	/// </summary>
+	enum class ArchiveColumn : int
+	{
+		OpenTime = 0,
+		CloseTime = 1,
+		OpenPrice = 2,
+		HighPrice = 3,
+		LowPrice = 4,
+		ClosePrice = 5,
+		Volume = 6,
+		QuoteVolume = 7,
+		TakerBuyBaseVolume = 8,
+		TakerBuyQuoteVolume = 9,
+		TradeCount = 10,
+	};
+
+	/// <summary>
+	/// Summary of a block of an archive.
+	/// The layout is shared with the managed side, so the structure must stay "plain".
+	/// </summary>
+	struct ArchiveBlockInfo
+	{
+		/// <summary>
+		/// Open time of the first k-line of the block (in milliseconds since Unix epoch).
+		/// </summary>
+		long long open_time{};
+
+		/// <summary>
+		/// Close time of the last k-line of the block (in milliseconds since Unix epoch).
+		/// </summary>
+		long long close_time{};
+
+		/// <summary>
+		/// Number of k-lines in the block.
+		/// </summary>
+		int kline_count{};
+		int reserved{};
+	};
+
+	/// <summary>
+	/// Read-only memory-mapped archive of blocks of k-lines stored column-wise ("structure of arrays"):
+	/// each block is a set of contiguous arrays, one per field of a k-line, preceded by an index of
+	/// the time intervals of all the blocks. The columns are either stored "as is", in which case they are
+	/// accessed directly in the mapped memory, or compressed (delta-of-delta encoding of the time-stamps,
+	/// XOR encoding of the prices and volumes), in which case a block is decoded on its first access.
+	/// All the methods are thread-safe.
+	/// </summary>
+	class KLineArchive
+	{
+	public:
+
+		/// <summary>
+		/// Number of columns in a block.
+		/// </summary>
+		static constexpr int ColumnCount = 11;
+
+	private:
+
+		/// <summary>
+		/// Entry of the index of blocks (as it is stored in the file).
+		/// </summary>
+		struct BlockEntry
+		{
+			ArchiveBlockInfo info;
+			std::uint64_t column_offsets[ColumnCount];
+			std::uint64_t column_sizes[ColumnCount];
+		};
+
+		MappedFile _file;
+		const BlockEntry* _entries{};
+		int _block_count{};
+		bool _compressed{};
+
+		/// <summary>
+		/// Decoded columns of the blocks (used only by compressed archives).
+		/// </summary>
+		mutable std::vector<std::unique_ptr<std::vector<char>>> _decoded_blocks;
+		mutable std::mutex _decode_mutex;
+
+		/// <summary>
+		/// Returns pointers to the beginning of each column of the given block.
+		/// </summary>
+		void get_columns(const int block_id, const char* (&columns)[ColumnCount]) const;
+
+		/// <summary>
+		/// Throws exception if the given block identifier is out of range.
+		/// </summary>
+		void validate_block_id(const int block_id) const;
+
+	public:
+
+		/// <summary>
+		/// Constructor. Maps the archive from the given file (throws exception if the file is invalid).
+		/// </summary>
+		explicit KLineArchive(const std::filesystem::path& file_path);
+
+		/// <summary>
+		/// Writes the given chronologically ordered <paramref name="items"/> into an archive file.
+		/// </summary>
+		/// <param name="file_path">Path to the file to write.</param>
+		/// <param name="block_count">Number of blocks.</param>
+		/// <param name="block_sizes">Number of k-lines in each block (the blocks follow one another in "items").</param>
+		/// <param name="items">K-lines of all the blocks.</param>
+		/// <param name="compress">Determines whether the columns get compressed.</param>
+		static void write(const std::filesystem::path& file_path, const int block_count, const int* block_sizes,
+			const PackedKLine* items, const bool compress);
+
+		/// <summary>
+		/// Number of blocks in the archive.
+		/// </summary>
+		int block_count() const;
+
+		/// <summary>
+		/// Returns "true" if the columns of the archive are compressed.
+		/// </summary>
+		bool is_compressed() const;
+
+		/// <summary>
+		/// Returns summary of the given block.
+		/// </summary>
+		ArchiveBlockInfo block_info(const int block_id) const;
+
+		/// <summary>
+		/// Writes k-lines [<paramref name="begin_kline_id"/>, <paramref name="begin_kline_id"/> + <paramref name="count"/>)
+		/// of the given block (clamped to the size of the block) into <paramref name="output"/>.
+		/// Returns number of the written k-lines.
+		/// </summary>
+		int read(const int block_id, const int begin_kline_id, const int count, PackedKLine* output) const;
+
+		/// <summary>
+		/// Returns view of the columns of the given block in the form the feature-engineering stage consumes them.
+		/// The view stays valid for the lifetime of the archive (for uncompressed archives it points to the mapped memory).
+		/// </summary>
+		KLineColumns columns(const int block_id) const;
+	};
+}
@@ -0,0 +1,215 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "KLineFeatures.h"
+#include "RNN.h"
+#include <algorithm>
+#include <cmath>
+
+namespace BAnalyzerNative
+{
+	namespace
+	{
+		/// <summary>
+		/// Number of windows evaluated in one go (bounds the size of the scratch buffer).
+		/// </summary>
+		constexpr int EvaluationChunkSize = 256;
+
+		/// <summary>
+		/// Regularization of the standard deviation in the z-score normalization.
+		/// </summary>
+		constexpr double DeviationEpsilon = 1e-12;
+
+		/// <summary>
+		/// Returns logarithm of the given ratio or "0" if any of its components is not positive (invalid k-line).
+		/// </summary>
+		double safe_log_ratio(const double numerator, const double denominator)
+		{
+			return numerator > 0 && denominator > 0 ? std::log(numerator / denominator) : 0.0;
+		}
+
+		/// <summary>
+		/// Throws exception if the given columns are not valid.
+		/// </summary>
+		void validate(const KLineColumns& columns)
+		{
+			if (columns.count <= 0 || !columns.open_price || !columns.high_price || !columns.low_price ||
+				!columns.close_price || !columns.volume || !columns.trade_count)
+				throw std::exception("Invalid k-line data.");
+		}
+
+		/// <summary>
+		/// Writes rolling z-score of the given <paramref name="raw"/> series into every "stride"-th element of
+		/// <paramref name="dest"/> (sums are updated incrementally, so the cost does not depend on the window size).
+		/// </summary>
+		void write_rolling_z_score(const std::vector<double>& raw, const int window, const int stride, double* dest)
+		{
+			auto sum = 0.0;
+			auto sum_sq = 0.0;
+
+			for (auto t = 0ull; t < raw.size(); ++t)
+			{
+				sum += raw[t];
+				sum_sq += raw[t] * raw[t];
+
+				if (t >= static_cast<std::size_t>(window))
+				{
+					const auto dropped = raw[t - window];
+					sum -= dropped;
+					sum_sq -= dropped * dropped;
+				}
+
+				if ((t + 1) % window == 0)
+				{
+					// Recalculate the sums from scratch once per window,
+					// so that the rounding errors do not accumulate over long series.
+					sum = 0.0;
+					sum_sq = 0.0;
+
+					for (auto i = t + 1 - window; i <= t; ++i)
+					{
+						sum += raw[i];
+						sum_sq += raw[i] * raw[i];
+					}
+				}
+
+				const auto n = static_cast<double>(std::min<std::size_t>(t + 1, window));
+				const auto mean = sum / n;
+				const auto variance = std::max(sum_sq / n - mean * mean, 0.0);
+				dest[t * stride] = (raw[t] - mean) / std::sqrt(variance + DeviationEpsilon);
+			}
+		}
+	}
+
+	void KLineFeatures::compute(const KLineColumns& columns, const int normalization_window, std::vector<double>& features)
+	{
+		validate(columns);
+
+		if (normalization_window <= 0)
+			throw std::exception("Invalid normalization window.");
+
+		const auto count = columns.count;
+		features.resize(static_cast<std::size_t>(count) * FeatureCount);
+
+		// Each raw feature is computed into the same scratch column
+		// and then normalized into its slot of the feature items.
+		std::vector<double> raw(count);
+
+		raw[0] = 0.0;
+		for (auto t = 1; t < count; ++t)
+			raw[t] = safe_log_ratio(columns.close_price[t], columns.close_price[t - 1]);
+		write_rolling_z_score(raw, normalization_window, FeatureCount, features.data());
+
+		for (auto t = 0; t < count; ++t)
+			raw[t] = safe_log_ratio(columns.high_price[t], columns.low_price[t]);
+		write_rolling_z_score(raw, normalization_window, FeatureCount, features.data() + 1);
+
+		for (auto t = 0; t < count; ++t)
+			raw[t] = safe_log_ratio(columns.close_price[t], columns.open_price[t]);
+		write_rolling_z_score(raw, normalization_window, FeatureCount, features.data() + 2);
+
+		for (auto t = 0; t < count; ++t)
+			raw[t] = std::log1p(std::max(columns.volume[t], 0.0));
+		write_rolling_z_score(raw, normalization_window, FeatureCount, features.data() + 3);
+
+		for (auto t = 0; t < count; ++t)
+			raw[t] = std::log1p(static_cast<double>(std::max(columns.trade_count[t], 0)));
+		write_rolling_z_score(raw, normalization_window, FeatureCount, features.data() + 4);
+	}
+
+	void KLineFeatures::compute_direction_labels(const KLineColumns& columns, std::vector<double>& labels)
+	{
+		validate(columns);
+		labels.resize(columns.count - 1);
+
+		for (auto t = 0; t < columns.count - 1; ++t)
+			labels[t] = columns.close_price[t + 1] > columns.close_price[t] ? 1.0 : 0.0;
+	}
+
+	int KLineFeatures::calc_window_count(const int item_count, const int time_depth)
+	{
+		return std::max(item_count - time_depth + 1, 0);
+	}
+
+	void KLineFeatures::pack_windows(const std::vector<double>& items, const int item_size, const int time_depth,
+		const int begin_window_id, const int end_window_id, std::vector<double>& dest)
+	{
+		const auto window_size = static_cast<std::size_t>(item_size) * time_depth;
+		dest.resize(window_size * (end_window_id - begin_window_id));
+		auto dest_ptr = dest.data();
+
+		for (auto window_id = begin_window_id; window_id < end_window_id; ++window_id, dest_ptr += window_size)
+		{
+			const auto src_ptr = items.data() + static_cast<std::size_t>(window_id) * item_size;
+			std::copy(src_ptr, src_ptr + window_size, dest_ptr);
+		}
+	}
+
+	int KLineFeatures::evaluate(const RNN& net, const KLineColumns& columns, const int normalization_window,
+		const int output_capacity, double* output)
+	{
+		if (net.in_size().xyz.coord_prod() != FeatureCount)
+			throw std::exception("Input item size of the net does not match the number of k-line features.");
+
+		const auto time_depth = static_cast<int>(net.in_size().w);
+		const auto window_count = calc_window_count(columns.count, time_depth);
+
+		if (window_count == 0)
+			throw std::exception("Not enough k-lines to fill a window.");
+
+		std::vector<double> features;
+		compute(columns, normalization_window, features);
+
+		std::vector<double> input_aggregate;
+		auto written_count = 0;
+
+		for (auto begin_window_id = 0; begin_window_id < window_count; begin_window_id += EvaluationChunkSize)
+		{
+			const auto end_window_id = std::min(begin_window_id + EvaluationChunkSize, window_count);
+			pack_windows(features, FeatureCount, time_depth, begin_window_id, end_window_id, input_aggregate);
+			written_count += net.evaluate_batch(static_cast<int>(input_aggregate.size()), input_aggregate.data(),
+				output_capacity - written_count, output + written_count);
+		}
+
+		return written_count;
+	}
+
+	void KLineFeatures::train(RNN& net, const KLineColumns& columns, const int normalization_window,
+		const double learning_rate)
+	{
+		if (net.in_size().xyz.coord_prod() != FeatureCount || net.out_size().xyz.coord_prod() != 1)
+			throw std::exception("Item sizes of the net do not match the k-line features and labels.");
+
+		const auto time_depth = static_cast<int>(net.in_size().w);
+		// The last k-line has no label, so does the last window.
+		const auto pair_count = calc_window_count(columns.count - 1, time_depth);
+
+		if (pair_count == 0)
+			throw std::exception("Not enough k-lines to fill a window.");
+
+		std::vector<double> features;
+		compute(columns, normalization_window, features);
+
+		std::vector<double> labels;
+		compute_direction_labels(columns, labels);
+
+		// The windows are cut out of the series by the net itself, so the overlapping
+		// time-points are neither copied into a packed aggregate nor converted twice.
+		net.train_series(static_cast<int>(labels.size()) * FeatureCount, features.data(),
+			static_cast<int>(labels.size()), labels.data(), 1, learning_rate);
+	}
+}
@@ -0,0 +1,106 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+#include <vector>
+
+namespace BAnalyzerNative
+{
+	class RNN;
+
+	/// <summary>
+	/// Read-only "structure of arrays" view of a series of k-lines
+	/// (all the arrays are expected to contain "count" elements).
+	/// </summary>
+	struct KLineColumns
+	{
+		int count{};
+		const double* open_price{};
+		const double* high_price{};
+		const double* low_price{};
+		const double* close_price{};
+		const double* volume{};
+		const int* trade_count{};
+	};
+
+	/// <summary>
+	/// Feature-engineering stage turning series of k-lines into input of RNN.
+	/// Each k-line is mapped to a time-point item of "FeatureCount" features:
+	/// log-return of the close price, log of the high/low ratio, log of the close/open ratio, log-volume and log-trade-count,
+	/// each normalized with the rolling z-score over the given number of the preceding k-lines.
+	/// Input items of the net are the sliding windows of the features with the length equal to the time depth of the net.
+	/// </summary>
+	class KLineFeatures
+	{
+		/// <summary>
+		/// Copies windows [<paramref name="begin_window_id"/>, <paramref name="end_window_id"/>) of the given
+		/// time-major <paramref name="items"/> into <paramref name="dest"/> (one after another).
+		/// </summary>
+		static void pack_windows(const std::vector<double>& items, const int item_size, const int time_depth,
+			const int begin_window_id, const int end_window_id, std::vector<double>& dest);
+
+	public:
+
+		/// <summary>
+		/// Number of features per k-line.
+		/// </summary>
+		static constexpr int FeatureCount = 5;
+
+		/// <summary>
+		/// Computes features of the given k-lines and stores them into <paramref name="features"/>
+		/// in the time-major order ("FeatureCount" consecutive features per k-line).
+		/// </summary>
+		/// <param name="columns">K-lines.</param>
+		/// <param name="normalization_window">Number of k-lines the rolling z-score normalization is done over.</param>
+		/// <param name="features">Container to store the result.</param>
+		static void compute(const KLineColumns& columns, const int normalization_window, std::vector<double>& features);
+
+		/// <summary>
+		/// Stores "1" into <paramref name="labels"/> for each k-line (but the last one) which is followed by
+		/// a k-line with a higher close price and "0" otherwise.
+		/// </summary>
+		static void compute_direction_labels(const KLineColumns& columns, std::vector<double>& labels);
+
+		/// <summary>
+		/// Returns number of sliding windows of the given length in a series of the given number of items.
+		/// </summary>
+		static int calc_window_count(const int item_count, const int time_depth);
+
+		/// <summary>
+		/// Evaluates the given net at each sliding window of the features of the given k-lines and writes
+		/// the concatenated results into <paramref name="output"/>. Returns number of the written elements.
+		/// </summary>
+		/// <param name="net">Net whose input item size must be equal to "FeatureCount".</param>
+		/// <param name="columns">K-lines.</param>
+		/// <param name="normalization_window">Number of k-lines the rolling z-score normalization is done over.</param>
+		/// <param name="output_capacity">Number of elements that can be written to <paramref name="output"/>.</param>
+		/// <param name="output">Buffer to store the result.</param>
+		static int evaluate(const RNN& net, const KLineColumns& columns, const int normalization_window,
+			const int output_capacity, double* output);
+
+		/// <summary>
+		/// Performs a training iteration of the given net on all the sliding windows of the features of the given k-lines.
+		/// The reference of each time-point is its "direction label" (see "compute_direction_labels"),
+		/// so the output item size of the net must be "1".
+		/// </summary>
+		/// <param name="net">Net whose input item size must be equal to "FeatureCount" and output item size to "1".</param>
+		/// <param name="columns">K-lines.</param>
+		/// <param name="normalization_window">Number of k-lines the rolling z-score normalization is done over.</param>
+		/// <param name="learning_rate">Factor determining aggressiveness of the training.</param>
+		static void train(RNN& net, const KLineColumns& columns, const int normalization_window, const double learning_rate);
+	};
+}
@@ -0,0 +1,163 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include "KLineResampler.h"
+#include <algorithm>
+#include <exception>
+
+namespace BAnalyzerNative
+{
+	namespace
+	{
+		/// <summary>
+		/// Gap between the close time of a k-line and the open time of the next one.
+		/// </summary>
+		constexpr long long KLineTimeGapMs = 1;
+
+		/// <summary>
+		/// Returns "true" if the given k-line carries no price data (see "KLine.Invalid" on the managed side).
+		/// </summary>
+		bool is_empty(const PackedKLine& item)
+		{
+			return item.open_price == 0 && item.high_price == 0 && item.low_price == 0 && item.close_price == 0;
+		}
+	}
+
+	KLineResampler::KLineResampler(const long long span_ms, const long long origin_ms) :
+		_span_ms(span_ms), _origin_ms(origin_ms)
+	{
+		if (span_ms <= 0)
+			throw std::exception("Invalid span of k-lines.");
+	}
+
+	long long KLineResampler::calc_bar_open_time(const long long time_ms) const
+	{
+		const auto offset = time_ms - _origin_ms;
+		// Floor division, so that time points before the origin are aligned correctly too.
+		const auto bar_id = offset / _span_ms - (offset % _span_ms < 0 ? 1 : 0);
+		return _origin_ms + bar_id * _span_ms;
+	}
+
+	PackedKLine KLineResampler::make_bar(const long long time_ms) const
+	{
+		PackedKLine result{};
+		result.open_time = calc_bar_open_time(time_ms);
+		result.close_time = result.open_time + _span_ms - KLineTimeGapMs;
+
+		return result;
+	}
+
+	void KLineResampler::merge(PackedKLine& bar, const PackedKLine& item)
+	{
+		bar.volume += item.volume;
+		bar.quote_volume += item.quote_volume;
+		bar.taker_buy_base_volume += item.taker_buy_base_volume;
+		bar.taker_buy_quote_volume += item.taker_buy_quote_volume;
+		// Unknown number of trades "poisons" the aggregate.
+		bar.trade_count = bar.trade_count < 0 || item.trade_count < 0 ? -1 : bar.trade_count + item.trade_count;
+
+		if (is_empty(item))
+			return;
+
+		if (is_empty(bar))
+		{
+			bar.open_price = item.open_price;
+			bar.high_price = item.high_price;
+			bar.low_price = item.low_price;
+		} else
+		{
+			bar.high_price = std::max(bar.high_price, item.high_price);
+			bar.low_price = std::min(bar.low_price, item.low_price);
+		}
+
+		bar.close_price = item.close_price;
+	}
+
+	int KLineResampler::push(const int count, const PackedKLine* items, const int output_capacity, PackedKLine* output)
+	{
+		if (count < 0 || (count > 0 && !items))
+			throw std::exception("Invalid k-line data.");
+
+		auto written_count = 0;
+
+		for (auto item_id = 0; item_id < count; ++item_id)
+		{
+			const auto& item = items[item_id];
+
+			if (_has_open_bar)
+			{
+				if (item.open_time < _last_item.open_time)
+					throw std::exception("K-lines must be ordered chronologically.");
+
+				if (item.open_time >= _open_bar.open_time + _span_ms)
+				{
+					// The fine k-line belongs to a later coarse one, so the open one is complete.
+					if (written_count >= output_capacity)
+						throw std::exception("Insufficient output capacity.");
+
+					get_open_bar(output[written_count++]);
+					_has_open_bar = false;
+				} else if (item.open_time > _last_item.open_time)
+					merge(_open_bar, _last_item);
+				// Otherwise the fine k-line is a "refreshed" version of the last one and just replaces it.
+			}
+
+			if (!_has_open_bar)
+			{
+				_open_bar = make_bar(item.open_time);
+				_has_open_bar = true;
+			}
+
+			_last_item = item;
+		}
+
+		return written_count;
+	}
+
+	bool KLineResampler::get_open_bar(PackedKLine& bar) const
+	{
+		if (!_has_open_bar)
+			return false;
+
+		bar = _open_bar;
+		merge(bar, _last_item);
+
+		return true;
+	}
+
+	void KLineResampler::reset()
+	{
+		_has_open_bar = false;
+	}
+
+	int KLineResampler::resample(const int count, const PackedKLine* items, const long long span_ms,
+		const long long origin_ms, const int output_capacity, PackedKLine* output)
+	{
+		KLineResampler resampler(span_ms, origin_ms);
+		auto written_count = resampler.push(count, items, output_capacity, output);
+
+		PackedKLine open_bar;
+		if (resampler.get_open_bar(open_bar))
+		{
+			if (written_count >= output_capacity)
+				throw std::exception("Insufficient output capacity.");
+
+			output[written_count++] = open_bar;
+		}
+
+		return written_count;
+	}
+}
@@ -0,0 +1,119 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#pragma once
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// K-line in the "packed" form it is exchanged with the managed side.
+	/// The time-stamps are in milliseconds since Unix epoch.
+	/// The layout is shared with the managed side, so the structure must stay "plain".
+	/// </summary>
+	struct PackedKLine
+	{
+		long long open_time{};
+		long long close_time{};
+		double open_price{};
+		double high_price{};
+		double low_price{};
+		double close_price{};
+		double volume{};
+		double quote_volume{};
+		double taker_buy_base_volume{};
+		double taker_buy_quote_volume{};
+
+		/// <summary>
+		/// Number of trades (negative if unknown).
+		/// </summary>
+		int trade_count{};
+		int reserved{};
+	};
+
+	/// <summary>
+	/// Aggregates a chronologically ordered series of (fine) k-lines into k-lines of a coarser granularity.
+	/// The coarse k-lines are aligned to "origin + n * span" time points.
+	/// The resampler works in a streaming manner: a coarse k-line is reported as complete once a fine k-line
+	/// of a later coarse one arrives, while the still-open one can be queried at any moment. The last fine k-line
+	/// can be "refreshed" (pushed again with the same open time), in which case it replaces its previous version,
+	/// so that live updates of the latest fine k-line can be fed as they come.
+	/// </summary>
+	class KLineResampler
+	{
+		long long _span_ms{};
+		long long _origin_ms{};
+
+		/// <summary>
+		/// Aggregate of all the fine k-lines of the open coarse k-line but the last one.
+		/// </summary>
+		PackedKLine _open_bar{};
+
+		/// <summary>
+		/// The last fine k-line of the open coarse k-line.
+		/// </summary>
+		PackedKLine _last_item{};
+
+		bool _has_open_bar{};
+
+		/// <summary>
+		/// Returns open time of the coarse k-line the given time point belongs to.
+		/// </summary>
+		long long calc_bar_open_time(const long long time_ms) const;
+
+		/// <summary>
+		/// Returns an empty coarse k-line that contains the given time point.
+		/// </summary>
+		PackedKLine make_bar(const long long time_ms) const;
+
+		/// <summary>
+		/// Adds the given fine k-line to the given coarse one.
+		/// </summary>
+		static void merge(PackedKLine& bar, const PackedKLine& item);
+
+	public:
+
+		/// <summary>
+		/// Constructor.
+		/// </summary>
+		/// <param name="span_ms">Duration of the coarse k-lines in milliseconds.</param>
+		/// <param name="origin_ms">A time point (in milliseconds since Unix epoch) at which a coarse k-line opens.</param>
+		KLineResampler(const long long span_ms, const long long origin_ms);
+
+		/// <summary>
+		/// Processes the given next fine k-lines and writes the coarse k-lines completed by them into
+		/// <paramref name="output"/>. Returns number of the written k-lines (never exceeds <paramref name="count"/>).
+		/// </summary>
+		int push(const int count, const PackedKLine* items, const int output_capacity, PackedKLine* output);
+
+		/// <summary>
+		/// Writes the still-open coarse k-line into <paramref name="bar"/>.
+		/// Returns "false" if there is no open coarse k-line.
+		/// </summary>
+		bool get_open_bar(PackedKLine& bar) const;
+
+		/// <summary>
+		/// Discards the open coarse k-line.
+		/// </summary>
+		void reset();
+
+		/// <summary>
+		/// Aggregates the given fine k-lines into coarse ones (including the last incomplete one)
+		/// and writes them into <paramref name="output"/>. Returns number of the written k-lines.
+		/// </summary>
+		static int resample(const int count, const PackedKLine* items, const long long span_ms,
+			const long long origin_ms, const int output_capacity, PackedKLine* output);
+	};
+}
@@ -0,0 +1,90 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "MappedFile.h"
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+namespace BAnalyzerNative
+{
+	MappedFile::MappedFile(const std::filesystem::path& file_path)
+	{
+		const auto file_handle = CreateFileW(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+			nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+		if (file_handle == INVALID_HANDLE_VALUE)
+			throw std::exception("Can't open the file.");
+
+		_file_handle = file_handle;
+
+		LARGE_INTEGER file_size{};
+		if (!GetFileSizeEx(file_handle, &file_size) || file_size.QuadPart <= 0)
+		{
+			close();
+			throw std::exception("Can't map an empty file.");
+		}
+
+		_size = static_cast<std::size_t>(file_size.QuadPart);
+		_mapping_handle = CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		if (!_mapping_handle)
+		{
+			close();
+			throw std::exception("Can't create mapping of the file.");
+		}
+
+		_data = MapViewOfFile(_mapping_handle, FILE_MAP_READ, 0, 0, 0);
+
+		if (!_data)
+		{
+			close();
+			throw std::exception("Can't map view of the file.");
+		}
+	}
+
+	void MappedFile::close() noexcept
+	{
+		if (_data)
+			UnmapViewOfFile(_data);
+
+		if (_mapping_handle)
+			CloseHandle(_mapping_handle);
+
+		if (_file_handle)
+			CloseHandle(_file_handle);
+
+		_data = nullptr;
+		_mapping_handle = nullptr;
+		_file_handle = nullptr;
+		_size = 0;
+	}
+
+	MappedFile::~MappedFile()
+	{
+		close();
+	}
+
+	const void* MappedFile::data() const
+	{
+		return _data;
+	}
+
+	std::size_t MappedFile::size() const
+	{
+		return _size;
+	}
+}
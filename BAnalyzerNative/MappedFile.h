@@ -0,0 +1,66 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+#include <cstddef>
+#include <filesystem>
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// Read-only view of a file mapped into memory.
+	/// The pages are backed by the file itself, so they are loaded lazily
+	/// and shared between all the processes mapping the same file.
+	/// </summary>
+	class MappedFile
+	{
+		void* _file_handle{};
+		void* _mapping_handle{};
+		const void* _data{};
+		std::size_t _size{};
+
+		/// <summary>
+		/// Releases all the resources held by the instance.
+		/// </summary>
+		void close() noexcept;
+
+	public:
+
+		/// <summary>
+		/// Constructor. Throws exception if the given file can't be mapped.
+		/// </summary>
+		explicit MappedFile(const std::filesystem::path& file_path);
+
+		/// <summary>
+		/// Destructor.
+		/// </summary>
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		/// <summary>
+		/// Pointer to the beginning of the mapped data.
+		/// </summary>
+		const void* data() const;
+
+		/// <summary>
+		/// Size of the mapped data in bytes.
+		/// </summary>
+		std::size_t size() const;
+	};
+}
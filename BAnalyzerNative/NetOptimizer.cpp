@@ -0,0 +1,120 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include "NetOptimizer.h"
+#include <cmath>
+
+namespace BAnalyzerNative
+{
+	namespace
+	{
+		/// <summary>
+		/// Calls the given function for each item of the gradient accumulated in the given context
+		/// (layer by layer, biases first), passing the index of the item in this order.
+		/// </summary>
+		template <class F>
+		std::size_t for_each_gradient_item(DeepLearning::MNet<DeepLearning::CpuDC>::Context& context, const F& func)
+		{
+			std::size_t item_id = 0;
+
+			for (auto& layer_gradient : context.gradients)
+			{
+				for (auto& tensor : layer_gradient.Biases_grad)
+					for (auto& item : tensor)
+						func(item_id++, item);
+
+				for (auto& tensor : layer_gradient.Weights_grad)
+					for (auto& item : tensor)
+						func(item_id++, item);
+			}
+
+			return item_id;
+		}
+	}
+
+	NetOptimizer::NetOptimizer(const OptimizerOptions& options) : _options(options)
+	{
+		if (options.optimizer < static_cast<int>(RnnOptimizer::Sgd) ||
+			options.optimizer > static_cast<int>(RnnOptimizer::AdamW) ||
+			options.beta1 < 0 || options.beta1 >= 1 || options.beta2 < 0 || options.beta2 >= 1 ||
+			options.epsilon <= 0 || options.weight_decay < 0 || options.accumulation_steps < 1)
+			throw std::exception("Invalid optimizer options.");
+	}
+
+	void NetOptimizer::step(DeepLearning::MNet<DeepLearning::CpuDC>& net,
+		DeepLearning::MNet<DeepLearning::CpuDC>::Context& gradient,
+		const double gradient_scale, const double learning_rate)
+	{
+		const auto optimizer = static_cast<RnnOptimizer>(_options.optimizer);
+
+		if (optimizer == RnnOptimizer::Sgd)
+		{
+			net.update(gradient, static_cast<DeepLearning::Real>(learning_rate * gradient_scale));
+			return;
+		}
+
+		if (_first_moment.empty())
+		{
+			const auto item_count = for_each_gradient_item(gradient, [](const std::size_t, const DeepLearning::Real) {});
+			_first_moment.resize(item_count);
+			_second_moment.resize(item_count);
+		}
+
+		++_step_count;
+
+		const auto beta1 = _options.beta1;
+		const auto beta2 = _options.beta2;
+		const auto first_correction = 1.0 - std::pow(beta1, static_cast<double>(_step_count));
+		const auto second_correction = 1.0 - std::pow(beta2, static_cast<double>(_step_count));
+		const auto moment_count = _first_moment.size();
+
+		const auto item_count = for_each_gradient_item(gradient, [&](const std::size_t item_id, DeepLearning::Real& item)
+			{
+				if (item_id >= moment_count)
+					throw std::exception("The optimizer does not match the net.");
+
+				const auto grad = static_cast<double>(item) * gradient_scale;
+				auto& first = _first_moment[item_id];
+
+				if (optimizer == RnnOptimizer::Momentum)
+				{
+					first = beta1 * first + grad;
+					item = static_cast<DeepLearning::Real>(first);
+					return;
+				}
+
+				auto& second = _second_moment[item_id];
+				first = beta1 * first + (1.0 - beta1) * grad;
+				second = beta2 * second + (1.0 - beta2) * grad * grad;
+				item = static_cast<DeepLearning::Real>(first / first_correction /
+					(std::sqrt(second / second_correction) + _options.epsilon));
+			});
+
+		if (item_count != moment_count)
+			throw std::exception("The optimizer does not match the net.");
+
+		if (optimizer == RnnOptimizer::AdamW)
+			net.update(gradient, static_cast<DeepLearning::Real>(learning_rate),
+				static_cast<DeepLearning::Real>(_options.weight_decay));
+		else
+			net.update(gradient, static_cast<DeepLearning::Real>(learning_rate));
+	}
+
+	const OptimizerOptions& NetOptimizer::options() const
+	{
+		return _options;
+	}
+}
@@ -0,0 +1,68 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#pragma once
+#include "NeuralNet/DataContext.h"
+#include "NeuralNet/MNet.h"
+#include "OptimizerOptions.h"
+#include <vector>
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// State of an adaptive optimizer ("Momentum", "Adam" or "AdamW") of an instance of MNet.
+	/// Each step replaces the gradient accumulated in the training context with the update direction of the optimizer
+	/// (computed from the moments kept per gradient item, in the order of the layers) and applies it with the regular
+	/// "update" of the net; the decoupled weight decay of "AdamW" is applied by the latter as well.
+	/// </summary>
+	class NetOptimizer
+	{
+		OptimizerOptions _options{};
+
+		/// <summary>
+		/// First and second moments of the gradient.
+		/// </summary>
+		std::vector<double> _first_moment{};
+		std::vector<double> _second_moment{};
+
+		/// <summary>
+		/// Number of performed steps.
+		/// </summary>
+		long long _step_count{};
+
+	public:
+
+		/// <summary>
+		/// Constructor.
+		/// </summary>
+		explicit NetOptimizer(const OptimizerOptions& options);
+
+		/// <summary>
+		/// Updates weights of the given <paramref name="net"/> according to the given <paramref name="gradient"/>
+		/// scaled with <paramref name="gradient_scale"/> (e.g., one over the number of the training pairs the gradient
+		/// is summed over) and the given <paramref name="learning_rate"/>.
+		/// The gradient is overwritten with the update direction, so it must be reset before being accumulated again.
+		/// </summary>
+		void step(DeepLearning::MNet<DeepLearning::CpuDC>& net,
+			DeepLearning::MNet<DeepLearning::CpuDC>::Context& gradient,
+			const double gradient_scale, const double learning_rate);
+
+		/// <summary>
+		/// Returns parameters of the optimizer.
+		/// </summary>
+		const OptimizerOptions& options() const;
+	};
+}
@@ -0,0 +1,132 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// A thread-safe pool of reusable objects of type <typeparamref name="T"/>.
+	/// New objects are default-constructed on demand, released objects are kept for further reuse.
+	/// </summary>
+	template <class T>
+	class ObjectPool
+	{
+		std::vector<std::unique_ptr<T>> _free_objects{};
+		std::mutex _mutex{};
+
+	public:
+
+		/// <summary>
+		/// "Lease" of an object from the pool. Returns the object back to the pool on destruction.
+		/// </summary>
+		class Lease
+		{
+			ObjectPool* _pool{};
+			T* _object{};
+
+		public:
+
+			/// <summary>
+			/// Constructor.
+			/// </summary>
+			Lease(ObjectPool& pool) : _pool(&pool), _object(pool.acquire()) {}
+
+			/// <summary>
+			/// Destructor.
+			/// </summary>
+			~Lease() { _pool->release(_object); }
+
+			Lease(const Lease&) = delete;
+			Lease& operator=(const Lease&) = delete;
+
+			/// <summary>
+			/// Access to the leased object.
+			/// </summary>
+			T& operator*() const { return *_object; }
+
+			/// <summary>
+			/// Access to the members of the leased object.
+			/// </summary>
+			T* operator->() const { return _object; }
+		};
+
+		/// <summary>
+		/// Returns a pointer to an object that is exclusively owned by the caller until it is released.
+		/// </summary>
+		T* acquire()
+		{
+			{
+				std::lock_guard lock(_mutex);
+
+				if (!_free_objects.empty())
+				{
+					auto result = _free_objects.back().release();
+					_free_objects.pop_back();
+					return result;
+				}
+			}
+
+			return new T();
+		}
+
+		/// <summary>
+		/// Makes sure that the pool contains at least <paramref name="count"/> free objects;
+		/// the objects that have to be added are passed to the given <paramref name="init"/> function first.
+		/// </summary>
+		template <class F>
+		void reserve(const std::size_t count, const F& init)
+		{
+			std::lock_guard lock(_mutex);
+
+			while (_free_objects.size() < count)
+			{
+				auto object = std::make_unique<T>();
+				init(*object);
+				_free_objects.push_back(std::move(object));
+			}
+		}
+
+		/// <summary>
+		/// Calls the given function for each of the free objects of the pool.
+		/// </summary>
+		template <class F>
+		void for_each_free(const F& func)
+		{
+			std::lock_guard lock(_mutex);
+
+			for (const auto& object : _free_objects)
+				func(*object);
+		}
+
+		/// <summary>
+		/// Returns the given object (previously acquired from the current pool) back to the pool.
+		/// </summary>
+		void release(T* object)
+		{
+			if (!object)
+				return;
+
+			std::unique_ptr<T> holder(object);
+			std::lock_guard lock(_mutex);
+			_free_objects.push_back(std::move(holder));
+		}
+	};
+}
@@ -0,0 +1,71 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#pragma once
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// Identifiers of the optimizers an RNN can be trained with
+	/// (values are part of the interface of the DLL and must not be changed).
+	/// </summary>
+	enum class RnnOptimizer : int
+	{
+		Sgd = 0,
+		Momentum = 1,
+		Adam = 2,
+		AdamW = 3,
+	};
+
+	/// <summary>
+	/// Parameters of the optimizer of an RNN (see RNN::set_optimizer).
+	/// The layout is shared with the managed side, so the structure must stay "plain".
+	/// </summary>
+	struct OptimizerOptions
+	{
+		/// <summary>
+		/// The optimizer ("RnnOptimizer" value).
+		/// </summary>
+		int optimizer{ static_cast<int>(RnnOptimizer::Sgd) };
+
+		/// <summary>
+		/// Decay factor (in [0, 1)) of the first moment of the gradient ("momentum" of the "Momentum" optimizer,
+		/// "beta1" of the "Adam" ones).
+		/// </summary>
+		double beta1{ 0.9 };
+
+		/// <summary>
+		/// Decay factor (in [0, 1)) of the second moment of the gradient ("beta2" of the "Adam" optimizers).
+		/// </summary>
+		double beta2{ 0.999 };
+
+		/// <summary>
+		/// Term added to the denominator of the "Adam" updates to improve numerical stability.
+		/// </summary>
+		double epsilon{ 1e-8 };
+
+		/// <summary>
+		/// Decoupled weight decay factor (the "AdamW" optimizer only).
+		/// </summary>
+		double weight_decay{ 0.01 };
+
+		/// <summary>
+		/// Number of consecutive training calls whose gradients are accumulated before the weights get updated
+		/// (the effective batch is the union of the batches of the calls).
+		/// </summary>
+		int accumulation_steps{ 1 };
+	};
+}
@@ -0,0 +1,260 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include "OrderBook.h"
+#include "SeriesKernels.h"
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <numeric>
+
+namespace BAnalyzerNative
+{
+	namespace
+	{
+		/// <summary>
+		/// Relative tolerance of rounding prices to the bucket boundaries
+		/// (keeps prices lying on a boundary, like "100.1" for buckets of "0.1", in their own bucket).
+		/// </summary>
+		constexpr double BucketTolerance = 1e-9;
+
+		/// <summary>
+		/// Throws an exception if the given levels are not valid ones.
+		/// </summary>
+		void check_levels(const int count, const double* prices, const double* quantities)
+		{
+			if (count < 0 || (count > 0 && (!prices || !quantities)))
+				throw std::exception("Invalid price levels.");
+
+			for (auto level_id = 0; level_id < count; ++level_id)
+				if (!std::isfinite(prices[level_id]) || prices[level_id] <= 0 ||
+					!std::isfinite(quantities[level_id]) || quantities[level_id] < 0)
+					throw std::exception("Invalid price level.");
+		}
+	}
+
+	const OrderBook::Side& OrderBook::side(const OrderBookSide side_id) const
+	{
+		switch (side_id)
+		{
+		case OrderBookSide::Bid: return _bids;
+		case OrderBookSide::Ask: return _asks;
+		default: throw std::exception("Unknown side of the order book.");
+		}
+	}
+
+	void OrderBook::sort_update(const bool descending, const int count, const double* prices, const double* quantities)
+	{
+		_order.resize(count);
+		std::iota(_order.begin(), _order.end(), 0);
+
+		// Stable sorting keeps the levels with equal prices in the order of arrival.
+		std::ranges::stable_sort(_order, [descending, prices](const int a, const int b)
+			{ return descending ? prices[a] > prices[b] : prices[a] < prices[b]; });
+
+		_update_prices.clear();
+		_update_quantities.clear();
+
+		for (const auto level_id : _order)
+		{
+			if (!_update_prices.empty() && _update_prices.back() == prices[level_id])
+			{
+				_update_quantities.back() = quantities[level_id];
+				continue;
+			}
+
+			_update_prices.push_back(prices[level_id]);
+			_update_quantities.push_back(quantities[level_id]);
+		}
+	}
+
+	void OrderBook::merge_update(Side& side)
+	{
+		const auto book_size = side.prices.size();
+		const auto update_size = _update_prices.size();
+
+		_merged_prices.clear();
+		_merged_quantities.clear();
+		_merged_prices.reserve(book_size + update_size);
+		_merged_quantities.reserve(book_size + update_size);
+
+		const auto precedes = [descending = side.descending](const double a, const double b)
+			{ return descending ? a > b : a < b; };
+
+		auto book_level_id = 0ull;
+		auto update_level_id = 0ull;
+
+		while (book_level_id < book_size || update_level_id < update_size)
+		{
+			if (update_level_id == update_size ||
+				(book_level_id < book_size && precedes(side.prices[book_level_id], _update_prices[update_level_id])))
+			{
+				_merged_prices.push_back(side.prices[book_level_id]);
+				_merged_quantities.push_back(side.quantities[book_level_id]);
+				++book_level_id;
+				continue;
+			}
+
+			// The update either introduces a new level or replaces (or removes) an existing one.
+			if (book_level_id < book_size && side.prices[book_level_id] == _update_prices[update_level_id])
+				++book_level_id;
+
+			if (_update_quantities[update_level_id] > 0)
+			{
+				_merged_prices.push_back(_update_prices[update_level_id]);
+				_merged_quantities.push_back(_update_quantities[update_level_id]);
+			}
+
+			++update_level_id;
+		}
+
+		// Swapping keeps the capacity of both the side and the scratch buffers.
+		side.prices.swap(_merged_prices);
+		side.quantities.swap(_merged_quantities);
+	}
+
+	void OrderBook::assign_side(Side& side, const int count, const double* prices, const double* quantities)
+	{
+		side.prices.clear();
+		side.quantities.clear();
+		update_side(side, count, prices, quantities);
+	}
+
+	void OrderBook::update_side(Side& side, const int count, const double* prices, const double* quantities)
+	{
+		if (count == 0)
+			return;
+
+		sort_update(side.descending, count, prices, quantities);
+		merge_update(side);
+	}
+
+	void OrderBook::accumulate(const int count, const double* quantities, double* cumulative)
+	{
+		std::partial_sum(quantities, quantities + count, cumulative);
+	}
+
+	void OrderBook::apply_snapshot(const long long update_id,
+		const int bid_count, const double* bid_prices, const double* bid_quantities,
+		const int ask_count, const double* ask_prices, const double* ask_quantities)
+	{
+		if (update_id < 0)
+			throw std::exception("Invalid update identifier.");
+
+		check_levels(bid_count, bid_prices, bid_quantities);
+		check_levels(ask_count, ask_prices, ask_quantities);
+
+		assign_side(_bids, bid_count, bid_prices, bid_quantities);
+		assign_side(_asks, ask_count, ask_prices, ask_quantities);
+		_update_id = update_id;
+	}
+
+	OrderBookDiffResult OrderBook::apply_diff(const long long first_update_id, const long long last_update_id,
+		const int bid_count, const double* bid_prices, const double* bid_quantities,
+		const int ask_count, const double* ask_prices, const double* ask_quantities)
+	{
+		if (first_update_id < 0 || first_update_id > last_update_id)
+			throw std::exception("Invalid range of update identifiers.");
+
+		check_levels(bid_count, bid_prices, bid_quantities);
+		check_levels(ask_count, ask_prices, ask_quantities);
+
+		if (_update_id < 0 || first_update_id > _update_id + 1)
+			return OrderBookDiffResult::Gap;
+
+		if (last_update_id <= _update_id)
+			return OrderBookDiffResult::Stale;
+
+		update_side(_bids, bid_count, bid_prices, bid_quantities);
+		update_side(_asks, ask_count, ask_prices, ask_quantities);
+		_update_id = last_update_id;
+
+		return OrderBookDiffResult::Applied;
+	}
+
+	long long OrderBook::update_id() const
+	{
+		return _update_id;
+	}
+
+	int OrderBook::level_count(const OrderBookSide side_id) const
+	{
+		return static_cast<int>(side(side_id).prices.size());
+	}
+
+	int OrderBook::get_depth(const OrderBookSide side_id, const int capacity,
+		double* prices, double* quantities, double* cumulative) const
+	{
+		const auto& levels = side(side_id);
+
+		if (capacity < 0 || (capacity > 0 && (!prices || !quantities)))
+			throw std::exception("Invalid output buffers.");
+
+		const auto count = std::min(capacity, static_cast<int>(levels.prices.size()));
+		std::copy_n(levels.prices.begin(), count, prices);
+		std::copy_n(levels.quantities.begin(), count, quantities);
+
+		if (cumulative)
+			accumulate(count, quantities, cumulative);
+
+		return count;
+	}
+
+	int OrderBook::aggregate(const OrderBookSide side_id, const double bucket_size, const int capacity,
+		double* prices, double* quantities, double* cumulative)
+	{
+		const auto& levels = side(side_id);
+
+		if (!std::isfinite(bucket_size) || bucket_size <= 0)
+			throw std::exception("Invalid bucket size.");
+
+		if (capacity < 0 || (capacity > 0 && (!prices || !quantities)))
+			throw std::exception("Invalid output buffers.");
+
+		const auto level_count = static_cast<int>(levels.prices.size());
+		const auto level_prices = levels.prices.data();
+		const auto inverse_bucket_size = 1.0 / bucket_size;
+		_bucket_prices.resize(level_count);
+		const auto bucket_prices = _bucket_prices.data();
+
+		// Bids are rounded down and asks up.
+		SeriesKernels::round_to_grid(level_prices, level_count, inverse_bucket_size,
+			levels.descending ? BucketTolerance : -BucketTolerance, bucket_size, !levels.descending, bucket_prices);
+
+		// Levels are sorted, so each bucket is a contiguous run of them.
+		auto bucket_count = 0;
+		for (auto level_id = 0; level_id < level_count; ++level_id)
+		{
+			if (bucket_count > 0 && prices[bucket_count - 1] == bucket_prices[level_id])
+			{
+				quantities[bucket_count - 1] += levels.quantities[level_id];
+				continue;
+			}
+
+			if (bucket_count == capacity)
+				break;
+
+			prices[bucket_count] = bucket_prices[level_id];
+			quantities[bucket_count] = levels.quantities[level_id];
+			++bucket_count;
+		}
+
+		if (cumulative)
+			accumulate(bucket_count, quantities, cumulative);
+
+		return bucket_count;
+	}
+}
@@ -0,0 +1,179 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#pragma once
+#include <vector>
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// Sides of an order book (values are part of the interface of the DLL).
+	/// </summary>
+	enum class OrderBookSide : int
+	{
+		Bid = 0,
+		Ask = 1,
+	};
+
+	/// <summary>
+	/// Outcomes of applying a diff update to an order book (values are part of the interface of the DLL).
+	/// </summary>
+	enum class OrderBookDiffResult : int
+	{
+		/// <summary>
+		/// The diff was merged into the book.
+		/// </summary>
+		Applied = 0,
+
+		/// <summary>
+		/// The diff is already covered by the book and was ignored.
+		/// </summary>
+		Stale = 1,
+
+		/// <summary>
+		/// Some updates preceding the diff are missing (or no snapshot was applied yet),
+		/// the book is left intact and must be re-synchronized with a snapshot.
+		/// </summary>
+		Gap = 2,
+	};
+
+	/// <summary>
+	/// Order book of a symbol kept up to date with exchange "diff" updates.
+	/// Each side is stored as a pair of flat arrays of prices and quantities sorted from the best price
+	/// (bids descending, asks ascending), so that a diff of "n" levels is merged in O(n log n + N) operations,
+	/// where "N" is the depth of the book; no memory is allocated once the scratch buffers are warmed up.
+	/// Not thread safe.
+	/// </summary>
+	class OrderBook
+	{
+		/// <summary>
+		/// Price levels of one side of the book.
+		/// </summary>
+		struct Side
+		{
+			std::vector<double> prices{};
+			std::vector<double> quantities{};
+
+			/// <summary>
+			/// "true" for the bid side (prices are sorted descending).
+			/// </summary>
+			bool descending{};
+		};
+
+		Side _bids{ {}, {}, true };
+		Side _asks{ {}, {}, false };
+
+		/// <summary>
+		/// Identifier of the last update reflected by the book ("-1" until a snapshot is applied).
+		/// </summary>
+		long long _update_id = -1;
+
+		/// <summary>
+		/// Scratch buffers of the updates.
+		/// </summary>
+		std::vector<int> _order{};
+		std::vector<double> _update_prices{};
+		std::vector<double> _update_quantities{};
+		std::vector<double> _merged_prices{};
+		std::vector<double> _merged_quantities{};
+
+		/// <summary>
+		/// Scratch buffer of the bucket prices.
+		/// </summary>
+		std::vector<double> _bucket_prices{};
+
+		/// <summary>
+		/// Returns side of the book corresponding to the given identifier.
+		/// </summary>
+		const Side& side(const OrderBookSide side_id) const;
+
+		/// <summary>
+		/// Writes the given levels into the update buffers sorted in the order of the given side;
+		/// of the levels with equal prices only the last one is kept.
+		/// </summary>
+		void sort_update(const bool descending, const int count, const double* prices, const double* quantities);
+
+		/// <summary>
+		/// Merges the content of the update buffers into the given side;
+		/// levels with zero quantities are removed from the side.
+		/// </summary>
+		void merge_update(Side& side);
+
+		/// <summary>
+		/// Replaces content of the given side with the given levels.
+		/// </summary>
+		void assign_side(Side& side, const int count, const double* prices, const double* quantities);
+
+		/// <summary>
+		/// Merges the given levels into the given side.
+		/// </summary>
+		void update_side(Side& side, const int count, const double* prices, const double* quantities);
+
+		/// <summary>
+		/// Writes running totals of the given <paramref name="count"/> quantities into <paramref name="cumulative"/>.
+		/// </summary>
+		static void accumulate(const int count, const double* quantities, double* cumulative);
+
+	public:
+
+		/// <summary>
+		/// Replaces content of the book with the given snapshot (levels may come in any order;
+		/// levels with zero quantities are skipped).
+		/// </summary>
+		void apply_snapshot(const long long update_id,
+			const int bid_count, const double* bid_prices, const double* bid_quantities,
+			const int ask_count, const double* ask_prices, const double* ask_quantities);
+
+		/// <summary>
+		/// Merges the given diff covering updates from <paramref name="first_update_id"/> to <paramref name="last_update_id"/>
+		/// into the book; a zero quantity removes the corresponding price level.
+		/// A diff is stale if <paramref name="last_update_id"/> does not exceed the update identifier of the book
+		/// and it leaves a gap if <paramref name="first_update_id"/> exceeds the identifier by more than one.
+		/// </summary>
+		OrderBookDiffResult apply_diff(const long long first_update_id, const long long last_update_id,
+			const int bid_count, const double* bid_prices, const double* bid_quantities,
+			const int ask_count, const double* ask_prices, const double* ask_quantities);
+
+		/// <summary>
+		/// Identifier of the last update reflected by the book ("-1" until a snapshot is applied).
+		/// </summary>
+		long long update_id() const;
+
+		/// <summary>
+		/// Returns number of price levels on the given side.
+		/// </summary>
+		int level_count(const OrderBookSide side_id) const;
+
+		/// <summary>
+		/// Writes at most <paramref name="capacity"/> best levels of the given side into <paramref name="prices"/>
+		/// and <paramref name="quantities"/> and, unless <paramref name="cumulative"/> is "null",
+		/// running totals of the quantities into <paramref name="cumulative"/>.
+		/// Returns number of the written levels.
+		/// </summary>
+		int get_depth(const OrderBookSide side_id, const int capacity,
+			double* prices, double* quantities, double* cumulative) const;
+
+		/// <summary>
+		/// Aggregates levels of the given side into price buckets of the given size (bids are rounded down
+		/// and asks up to a multiple of <paramref name="bucket_size"/>) and writes at most <paramref name="capacity"/>
+		/// best buckets into <paramref name="prices"/> and <paramref name="quantities"/> and, unless
+		/// <paramref name="cumulative"/> is "null", running totals of the quantities into <paramref name="cumulative"/>.
+		/// Returns number of the written buckets.
+		/// </summary>
+		int aggregate(const OrderBookSide side_id, const double bucket_size, const int capacity,
+			double* prices, double* quantities, double* cumulative);
+	};
+}
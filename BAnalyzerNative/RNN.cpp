@@ -21,49 +21,240 @@
 #include "NeuralNet/LazyVector.h"
 #include "NeuralNet/MNet.h"
 #include "DataConversionUtils.h"
+#include "MappedFile.h"
+#include "ThreadPool.h"
+#include "CheckpointCompression.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <msgpack.hpp>
+#include <numeric>
+#include <random>
 
 using namespace DeepLearning;
 
 namespace BAnalyzerNative
 {
-	RNN::RNN(const int time_depth, const int layer_item_sizes_count, const int* layer_item_sizes)
+	namespace
+	{
+		/// <summary>
+		/// Signature identifying files of saved nets ("BANR").
+		/// </summary>
+		constexpr std::uint32_t CheckpointSignature = 0x524E4142;
+
+		/// <summary>
+		/// Version of the format of saved nets; to be incremented on any change of the layout.
+		/// </summary>
+		constexpr std::uint32_t CheckpointVersion = 2;
+
+		/// <summary>
+		/// Header of a file of a saved net. It is followed by "layer_item_sizes_count" 32-bit integers
+		/// (item sizes of the layers) and then by "weights_size" bytes of the serialized net
+		/// ("cost" is an "RnnCost" value; activation functions are stored with the layers of the serialized net).
+		/// Version 1 of the format ends with the "weights_size" field and stores the weights in full precision.
+		/// </summary>
+		struct CheckpointHeader
+		{
+			std::uint32_t signature;
+			std::uint32_t version;
+			std::uint32_t real_size;
+			std::int32_t time_depth;
+			std::int32_t layer_item_sizes_count;
+			std::uint32_t cost;
+			std::uint64_t weights_size;
+			std::uint32_t weight_precision;
+			std::uint32_t reserved;
+		};
+
+		/// <summary>
+		/// Size of the header in version 1 of the format.
+		/// </summary>
+		constexpr auto CheckpointHeaderV1Size = offsetof(CheckpointHeader, weight_precision);
+
+		/// <summary>
+		/// Returns identifier of the given activation function in terms of the DeepLearning library.
+		/// </summary>
+		ActivationFunctionId to_activation_function_id(const RnnActivation activation)
+		{
+			switch (activation)
+			{
+			case RnnActivation::Sigmoid: return ActivationFunctionId::SIGMOID;
+			case RnnActivation::Tanh: return ActivationFunctionId::TANH;
+			case RnnActivation::Relu: return ActivationFunctionId::RELU;
+			case RnnActivation::Linear: return ActivationFunctionId::LINEAR;
+			default: throw std::exception("Unsupported activation function.");
+			}
+		}
+
+		/// <summary>
+		/// Returns identifier of the given cost function in terms of the DeepLearning library.
+		/// </summary>
+		CostFunctionId to_cost_function_id(const RnnCost cost)
+		{
+			switch (cost)
+			{
+			case RnnCost::CrossEntropy: return CostFunctionId::CROSS_ENTROPY;
+			case RnnCost::SquaredError: return CostFunctionId::SQUARED_ERROR;
+			default: throw std::exception("Unsupported cost function.");
+			}
+		}
+	}
+
+	RNN::RNN(const int time_depth, const int layer_item_sizes_count, const int* layer_item_sizes,
+		const RnnActivation* activations, const RnnCost cost) :
+		_time_depth(time_depth), _cost(cost)
 	{
 		if (layer_item_sizes_count < 2)
 			throw std::exception("Can't construct the net.");
 
+		to_cost_function_id(cost); // validates the cost function
+
 		Index4d in_size{ {1, 1, layer_item_sizes[0]}, time_depth };
 
 		for (auto layer_id = 1; layer_id < layer_item_sizes_count; ++layer_id)
 		{
 			in_size = _net.append_layer<RMLayer>(in_size, Index4d{ {1, 1, layer_item_sizes[layer_id]}, time_depth },
-				FillRandomNormal, ActivationFunctionId::SIGMOID);
+				FillRandomNormal, to_activation_function_id(activations ? activations[layer_id - 1] : RnnActivation::Sigmoid));
 		}
 
-		_context = _net.allocate_context();
+		_layer_item_sizes.assign(layer_item_sizes, layer_item_sizes + layer_item_sizes_count);
 		_plain_input_size = static_cast<int>(_net.in_size().xyz.coord_prod() * _net.in_size().w);
 		_plain_output_size = static_cast<int>(_net.out_size().xyz.coord_prod() * _net.out_size().w);
 	}
 
+	int RNN::calc_output_aggregate_size(const int in_aggregate_size) const
+	{
+		if (in_aggregate_size <= 0 || in_aggregate_size % _plain_input_size != 0)
+			throw std::exception("Invalid input data.");
+
+		return in_aggregate_size / _plain_input_size * _plain_output_size;
+	}
+
 	void RNN::evaluate(const int size, const double* input, LazyVector<double>& output) const
 	{
+		output.resize(_plain_output_size);
+		evaluate(size, input, _plain_output_size, output.begin());
+	}
 
+	int RNN::evaluate(const int size, const double* input, const int output_capacity, double* output) const
+	{
 		if (size != _plain_input_size)
 			throw std::exception("Invalid input data.");
 
-		thread_local LazyVector<CpuDC::tensor_t> input_lazy{};
+		return evaluate_batch(size, input, output_capacity, output);
+	}
+
+	void RNN::evaluate_batch(const int in_aggregate_size, const double* input_aggregate,
+		LazyVector<double>& output_aggregate) const
+	{
+		const auto out_aggregate_size = calc_output_aggregate_size(in_aggregate_size);
+		output_aggregate.resize(out_aggregate_size);
+		evaluate_batch(in_aggregate_size, input_aggregate, out_aggregate_size, output_aggregate.begin());
+	}
+
+	int RNN::evaluate_batch(const int in_aggregate_size, const double* input_aggregate,
+		const int output_capacity, double* output_aggregate) const
+	{
+		const ObjectPool<EvalContext>::Lease context(_eval_context_pool);
+
+		return evaluate_batch(in_aggregate_size, input_aggregate, output_capacity, output_aggregate, *context);
+	}
+
+	int RNN::evaluate_batch(const int in_aggregate_size, const double* input_aggregate,
+		const int output_capacity, double* output_aggregate, EvalContext& context) const
+	{
+		return evaluate_batch_impl(in_aggregate_size, input_aggregate, output_capacity, output_aggregate, context);
+	}
+
+	int RNN::evaluate_batch(const int in_aggregate_size, const float* input_aggregate,
+		const int output_capacity, float* output_aggregate, EvalContext& context) const
+	{
+		return evaluate_batch_impl(in_aggregate_size, input_aggregate, output_capacity, output_aggregate, context);
+	}
+
+	int RNN::evaluate_batch(const int in_aggregate_size, const float* input_aggregate,
+		const int output_capacity, float* output_aggregate) const
+	{
+		const ObjectPool<EvalContext>::Lease context(_eval_context_pool);
+
+		return evaluate_batch_impl(in_aggregate_size, input_aggregate, output_capacity, output_aggregate, *context);
+	}
+
+	template <class T>
+	int RNN::evaluate_batch_impl(const int in_aggregate_size, const T* input_aggregate,
+		const int output_capacity, T* output_aggregate, EvalContext& context) const
+	{
+		const auto out_aggregate_size = calc_output_aggregate_size(in_aggregate_size);
+
+		if (output_capacity < out_aggregate_size || !output_aggregate)
+			throw std::exception("Insufficient output capacity.");
+
+		const auto item_count = in_aggregate_size / _plain_input_size;
+
 		const auto in_size = _net.in_size();
-		input_lazy.resize(in_size.w);
-		DataConversionUtils::fill_lazy_vector(in_size.xyz.coord_prod(), input, input_lazy);
+		const auto in_item_size = in_size.xyz.coord_prod();
+		context.input.resize(in_size.w);
 
-		thread_local InOutMData<CpuDC> cache{};
-		_net.act(input_lazy, cache);
+		auto raw_input_begin = input_aggregate;
+		auto raw_output_begin = output_aggregate;
 
-		output.resize(_plain_output_size);
-		DataConversionUtils::pack_lazy_vector(cache.out(), output.begin());
+		BANALYZER_COUNT(_stats.evaluate_call_count, 1);
+		BANALYZER_COUNT(_stats.evaluated_item_count, item_count);
+		BANALYZER_COUNT(_stats.converted_byte_count, (in_aggregate_size + out_aggregate_size) * sizeof(T));
+
+		std::shared_lock lock(_weights_mutex);
+
+		for (auto item_id = 0; item_id < item_count; ++item_id)
+		{
+			{
+				BANALYZER_SCOPED_TIMER(_stats.conversion_time_ns);
+				[[maybe_unused]] const auto resized_count =
+					DataConversionUtils::fill_lazy_vector(in_item_size, raw_input_begin, context.input);
+				BANALYZER_COUNT(_stats.allocation_count, resized_count);
+			}
+
+			{
+				BANALYZER_SCOPED_TIMER(_stats.forward_time_ns);
+				_net.act(context.input, context.cache);
+			}
+
+			{
+				BANALYZER_SCOPED_TIMER(_stats.conversion_time_ns);
+				DataConversionUtils::pack_lazy_vector(context.cache.out(), raw_output_begin);
+			}
+
+			raw_input_begin += _plain_input_size;
+			raw_output_begin += _plain_output_size;
+		}
+
+		return out_aggregate_size;
 	}
 
-	void RNN::train(const int in_aggregate_size, const double* input_aggregate, const int ref_aggregate_size,
-		const double* reference_aggregate, const double learning_rate)
+	RNN::EvalContext* RNN::acquire_context() const
+	{
+		return _eval_context_pool.acquire();
+	}
+
+	void RNN::release_context(EvalContext* context) const
+	{
+		_eval_context_pool.release(context);
+	}
+
+	void RNN::evaluate(const LazyVector<CpuDC::tensor_t>& input, InOutMData<CpuDC>& result) const
+	{
+		if (input.size() != static_cast<std::size_t>(_net.in_size().w))
+			throw std::exception("Invalid input data.");
+
+		BANALYZER_SCOPED_TIMER(_stats.forward_time_ns);
+		std::shared_lock lock(_weights_mutex);
+		_net.act(input, result);
+	}
+
+	int RNN::calc_training_pair_count(const int in_aggregate_size, const int ref_aggregate_size) const
 	{
 		if (in_aggregate_size % _plain_input_size != 0 ||
 			ref_aggregate_size % _plain_output_size != 0)
@@ -74,11 +265,21 @@ namespace BAnalyzerNative
 		if (training_pair_count != ref_aggregate_size / _plain_output_size)
 			throw std::exception("Invalid input.");
 
-		thread_local LazyVector<LazyVector<CpuDC::tensor_t>> input_lazy{};
-		input_lazy.resize(training_pair_count);
+		return training_pair_count;
+	}
+
+	template <class T>
+	void RNN::convert_training_data(const int pair_count, const T* input_aggregate,
+		const T* reference_aggregate, LazyVector<LazyVector<CpuDC::tensor_t>>& input_dest,
+		LazyVector<LazyVector<CpuDC::tensor_t>>& reference_dest) const
+	{
+		BANALYZER_SCOPED_TIMER(_stats.conversion_time_ns);
+		BANALYZER_COUNT(_stats.converted_byte_count,
+			static_cast<long long>(pair_count) * (_plain_input_size + _plain_output_size) * sizeof(T));
 
-		thread_local LazyVector<LazyVector<CpuDC::tensor_t>> reference_lazy{};
-		reference_lazy.resize(training_pair_count);
+		input_dest.resize(pair_count);
+		reference_dest.resize(pair_count);
+		[[maybe_unused]] auto resized_count = 0;
 
 		auto raw_input_begin = input_aggregate;
 		auto raw_reference_begin = reference_aggregate;
@@ -88,21 +289,827 @@ namespace BAnalyzerNative
 		const auto out_size = _net.out_size();
 		const auto ref_item_size = out_size.xyz.coord_prod();
 
-		for (auto pair_id = 0; pair_id < training_pair_count; ++pair_id)
+		for (auto pair_id = 0; pair_id < pair_count; ++pair_id)
 		{
-			auto& in = input_lazy[pair_id];
+			auto& in = input_dest[pair_id];
 			in.resize(in_size.w);
-			DataConversionUtils::fill_lazy_vector(in_item_size, raw_input_begin, in);
+			resized_count += DataConversionUtils::fill_lazy_vector(in_item_size, raw_input_begin, in);
 			raw_input_begin += _plain_input_size;
 
-			auto& ref = reference_lazy[pair_id];
+			auto& ref = reference_dest[pair_id];
 			ref.resize(out_size.w);
-			DataConversionUtils::fill_lazy_vector(ref_item_size, raw_reference_begin, ref);
+			resized_count += DataConversionUtils::fill_lazy_vector(ref_item_size, raw_reference_begin, ref);
 			raw_reference_begin += _plain_output_size;
 		}
 
-		_net.learn(input_lazy, reference_lazy, CostFunction<CpuDC::tensor_t>(CostFunctionId::CROSS_ENTROPY),
-			static_cast<Real>(learning_rate), _context);
+		BANALYZER_COUNT(_stats.allocation_count, resized_count);
+	}
+
+	void RNN::train(const int in_aggregate_size, const double* input_aggregate, const int ref_aggregate_size,
+		const double* reference_aggregate, const double learning_rate)
+	{
+		const auto training_pair_count = calc_training_pair_count(in_aggregate_size, ref_aggregate_size);
+		check_scratch_limit(training_pair_count);
+
+		std::lock_guard train_lock(_train_mutex);
+		convert_training_data(training_pair_count, input_aggregate, reference_aggregate,
+			_train_input, _train_reference);
+		learn_converted(learning_rate);
+	}
+
+	void RNN::train(const int in_aggregate_size, const float* input_aggregate, const int ref_aggregate_size,
+		const float* reference_aggregate, const double learning_rate)
+	{
+		const auto training_pair_count = calc_training_pair_count(in_aggregate_size, ref_aggregate_size);
+		check_scratch_limit(training_pair_count);
+
+		std::lock_guard train_lock(_train_mutex);
+		convert_training_data(training_pair_count, input_aggregate, reference_aggregate,
+			_train_input, _train_reference);
+		learn_converted(learning_rate);
+	}
+
+	void RNN::learn_converted(const double learning_rate)
+	{
+		if (_frozen)
+			throw std::exception("The net is frozen.");
+
+		const auto cost_func = CostFunction<CpuDC::tensor_t>(to_cost_function_id(_cost));
+		const auto pair_count = static_cast<int>(_train_input.size());
+		BANALYZER_COUNT(_stats.train_batch_count, 1);
+		BANALYZER_COUNT(_stats.trained_pair_count, pair_count);
+
+		if (_optimizer || _optimizer_options.accumulation_steps > 1)
+		{
+			learn_optimized(pair_count, cost_func, learning_rate);
+			return;
+		}
+
+		if (_thread_count > 1 && pair_count > 1)
+		{
+			learn_parallel(pair_count, cost_func, learning_rate);
+			return;
+		}
+
+		ensure_training_context();
+		BANALYZER_SCOPED_TIMER(_stats.learn_time_ns);
+		auto& context = *_context;
+
+		{
+			// Gradient calculation only reads the weights, so evaluation can go on meanwhile.
+			std::shared_lock weights_lock(_weights_mutex);
+			context.reset_gradient();
+
+			for (auto pair_id = 0; pair_id < pair_count; ++pair_id)
+				_net.calc_gradient(_train_input[pair_id], _train_reference[pair_id], cost_func, context);
+		}
+
+		std::unique_lock weights_lock(_weights_mutex);
+		_net.update(context, static_cast<Real>(learning_rate / pair_count));
+	}
+
+	void RNN::ensure_training_context()
+	{
+		if (_context)
+			return;
+
+		_context = _net.allocate_context();
+		BANALYZER_COUNT(_stats.allocation_count, 1);
+	}
+
+	namespace
+	{
+		/// <summary>
+		/// Kernel summing up the cost function <typeparamref name="C"/> over all the elements of
+		/// an output-reference pair of items.
+		/// </summary>
+		template <RnnCost C>
+		struct CostKernel;
+
+		template <>
+		struct CostKernel<RnnCost::CrossEntropy>
+		{
+			static double sum(const CpuDC::tensor_t& output, const CpuDC::tensor_t& reference)
+			{
+				constexpr auto eps = 1e-12;
+				auto result = 0.0;
+				auto ref_it = reference.begin();
+
+				for (const auto out_value : output)
+				{
+					const auto out = std::clamp(static_cast<double>(out_value), eps, 1.0 - eps);
+					const auto ref = static_cast<double>(*ref_it++);
+					result -= ref * std::log(out) + (1.0 - ref) * std::log(1.0 - out);
+				}
+
+				return result;
+			}
+		};
+
+		template <>
+		struct CostKernel<RnnCost::SquaredError>
+		{
+			static double sum(const CpuDC::tensor_t& output, const CpuDC::tensor_t& reference)
+			{
+				auto result = 0.0;
+				auto ref_it = reference.begin();
+
+				for (const auto out_value : output)
+				{
+					const auto diff = static_cast<double>(out_value) - static_cast<double>(*ref_it++);
+					result += 0.5 * diff * diff;
+				}
+
+				return result;
+			}
+		};
+	}
+
+	template <class L>
+	double RNN::calc_cost(const int begin_pair_id, const int end_pair_id, const L& load_pair) const
+	{
+		switch (_cost)
+		{
+		case RnnCost::CrossEntropy: return calc_cost_impl<RnnCost::CrossEntropy>(begin_pair_id, end_pair_id, load_pair);
+		case RnnCost::SquaredError: return calc_cost_impl<RnnCost::SquaredError>(begin_pair_id, end_pair_id, load_pair);
+		default: throw std::exception("Unsupported cost function.");
+		}
+	}
+
+	template <RnnCost C, class L>
+	double RNN::calc_cost_impl(const int begin_pair_id, const int end_pair_id, const L& load_pair) const
+	{
+		if (begin_pair_id >= end_pair_id)
+			return 0.0;
+
+		const ObjectPool<EvalContext>::Lease context(_eval_context_pool);
+		auto cost_sum = 0.0;
+
+		for (auto pair_id = begin_pair_id; pair_id < end_pair_id; ++pair_id)
+		{
+			load_pair(pair_id, context->input, context->reference);
+			evaluate(context->input, context->cache);
+			const auto& out = context->cache.out();
+			const auto& ref = context->reference;
+
+			for (auto item_id = 0ull; item_id < out.size(); ++item_id)
+				cost_sum += CostKernel<C>::sum(out[item_id], ref[item_id]);
+		}
+
+		return cost_sum / (static_cast<double>(end_pair_id - begin_pair_id) * _plain_output_size);
+	}
+
+	namespace
+	{
+		/// <summary>
+		/// A task executed on the shared thread pool; the destructor waits for its completion, so that
+		/// the task can safely refer to the data of the scope the instance is declared in.
+		/// </summary>
+		class BackgroundTask
+		{
+			std::future<void> _done{};
+
+		public:
+
+			BackgroundTask() = default;
+			BackgroundTask(const BackgroundTask&) = delete;
+			BackgroundTask& operator=(const BackgroundTask&) = delete;
+
+			~BackgroundTask()
+			{
+				if (_done.valid())
+					_done.wait();
+			}
+
+			/// <summary>
+			/// Starts execution of the given task (the previous one must be waited for).
+			/// </summary>
+			void start(std::function<void()> task)
+			{
+				const auto promise = std::make_shared<std::promise<void>>();
+				_done = promise->get_future();
+				ThreadPool::shared().submit([promise, task = std::move(task)]()
+					{
+						try
+						{
+							task();
+							promise->set_value();
+						} catch (...)
+						{
+							promise->set_exception(std::current_exception());
+						}
+					});
+			}
+
+			/// <summary>
+			/// Waits until the started task (if any) is completed and re-throws its exception (if any).
+			/// </summary>
+			void wait()
+			{
+				if (_done.valid())
+					_done.get();
+			}
+		};
+	}
+
+	template <class L>
+	FitResult RNN::fit_impl(const int pair_count, const FitOptions& options, const L& load_pair,
+		const EpochCallback& on_epoch, const std::stop_token& stop_token)
+	{
+		if (options.epoch_count < 1 || options.batch_size < 1 ||
+			options.validation_fraction < 0 || options.validation_fraction >= 1)
+			throw std::exception("Invalid training options.");
+
+		const auto validation_pair_count = static_cast<int>(pair_count * options.validation_fraction);
+		const auto training_pair_count = pair_count - validation_pair_count;
+
+		if (training_pair_count < 1)
+			throw std::exception("Invalid training options.");
+
+		check_scratch_limit(std::min(options.batch_size, training_pair_count));
+		std::lock_guard train_lock(_train_mutex);
+
+		std::vector<int> pair_ids(training_pair_count);
+		std::iota(pair_ids.begin(), pair_ids.end(), 0);
+		std::vector<int> next_pair_ids{};
+		std::mt19937 generator(options.seed);
+		const auto batch_count = (training_pair_count + options.batch_size - 1) / options.batch_size;
+
+		// Only the pairs of a single mini-batch are converted at a time, so the
+		// tensors of the training containers are reused from batch to batch.
+		const auto load_batch = [&](const std::vector<int>& ids, const int batch_id)
+			{
+				const auto batch_begin = batch_id * options.batch_size;
+				const auto batch_size = std::min(options.batch_size, training_pair_count - batch_begin);
+				_prefetch_input.resize(batch_size);
+				_prefetch_reference.resize(batch_size);
+
+				BANALYZER_SCOPED_TIMER(_stats.conversion_time_ns);
+				BANALYZER_COUNT(_stats.converted_byte_count,
+					static_cast<long long>(batch_size) * (_plain_input_size + _plain_output_size) * sizeof(double));
+
+				for (auto item_id = 0; item_id < batch_size; ++item_id)
+					load_pair(ids[batch_begin + item_id], _prefetch_input[item_id], _prefetch_reference[item_id]);
+			};
+
+		// The next mini-batch (possibly the first one of the next epoch) is converted into
+		// the "prefetch" containers while the current one is learned from the "train" ones.
+		BackgroundTask loader;
+		std::ranges::shuffle(pair_ids, generator);
+		loader.start([&]() { load_batch(pair_ids, 0); });
+
+		FitResult result{};
+		auto epochs_without_improvement = 0;
+
+		// Weights of the best epoch (packed the same way as in checkpoints); they are
+		// restored when the training ends, unless the net has not been trained since.
+		msgpack::sbuffer best_weights;
+		auto trained_since_best = false;
+		const auto restore_best_weights = [&]()
+			{
+				if (result.best_epoch < 0 || !trained_since_best)
+					return;
+
+				const auto handle = msgpack::unpack(best_weights.data(), best_weights.size());
+				std::unique_lock weights_lock(_weights_mutex);
+				handle.get().convert(_net);
+			};
+
+		for (auto epoch_id = 0; epoch_id < options.epoch_count; ++epoch_id)
+		{
+			for (auto batch_id = 0; batch_id < batch_count; ++batch_id)
+			{
+				loader.wait();
+
+				// The loader of the first mini-batch reads the shuffled order of the epoch,
+				// so the order can be taken over only after the loader is done.
+				if (batch_id == 0 && epoch_id > 0)
+					pair_ids.swap(next_pair_ids);
+
+				if (stop_token.stop_requested())
+				{
+					restore_best_weights();
+					return result;
+				}
+
+				std::swap(_train_input, _prefetch_input);
+				std::swap(_train_reference, _prefetch_reference);
+
+				if (batch_id + 1 < batch_count)
+					loader.start([&, batch_id]() { load_batch(pair_ids, batch_id + 1); });
+				else if (epoch_id + 1 < options.epoch_count)
+				{
+					// Shuffling a copy consumes the generator exactly as shuffling in place at the next epoch would.
+					next_pair_ids = pair_ids;
+					std::ranges::shuffle(next_pair_ids, generator);
+					loader.start([&]() { load_batch(next_pair_ids, 0); });
+				}
+
+				learn_converted(options.learning_rate);
+				trained_since_best = true;
+			}
+
+			result.epoch_count = epoch_id + 1;
+
+			if (validation_pair_count == 0)
+			{
+				if (on_epoch)
+					on_epoch(epoch_id, calc_cost(0, training_pair_count, load_pair));
+
+				continue;
+			}
+
+			result.last_validation_cost = calc_cost(training_pair_count, pair_count, load_pair);
+
+			if (on_epoch)
+				on_epoch(epoch_id, result.last_validation_cost);
+
+			if (result.best_epoch < 0 || result.last_validation_cost < result.best_validation_cost)
+			{
+				result.best_epoch = epoch_id;
+				result.best_validation_cost = result.last_validation_cost;
+				epochs_without_improvement = 0;
+
+				best_weights.clear();
+				std::shared_lock weights_lock(_weights_mutex);
+				msgpack::pack(best_weights, _net);
+				trained_since_best = false;
+			} else if (options.patience > 0 && ++epochs_without_improvement >= options.patience)
+				break;
+		}
+
+		restore_best_weights();
+		return result;
+	}
+
+	FitResult RNN::fit(const int in_aggregate_size, const double* input_aggregate, const int ref_aggregate_size,
+		const double* reference_aggregate, const FitOptions& options,
+		const EpochCallback& on_epoch, const std::stop_token& stop_token)
+	{
+		const auto pair_count = calc_training_pair_count(in_aggregate_size, ref_aggregate_size);
+		const auto in_size = _net.in_size();
+		const auto out_size = _net.out_size();
+
+		return fit_impl(pair_count, options, [&](const int pair_id, LazyVector<CpuDC::tensor_t>& in, LazyVector<CpuDC::tensor_t>& ref)
+			{
+				in.resize(in_size.w);
+				DataConversionUtils::fill_lazy_vector(in_size.xyz.coord_prod(),
+					input_aggregate + static_cast<std::size_t>(pair_id) * _plain_input_size, in);
+				ref.resize(out_size.w);
+				DataConversionUtils::fill_lazy_vector(out_size.xyz.coord_prod(),
+					reference_aggregate + static_cast<std::size_t>(pair_id) * _plain_output_size, ref);
+			}, on_epoch, stop_token);
+	}
+
+	int RNN::calc_window_count(const int series_size, const int ref_series_size, const int stride) const
+	{
+		const auto in_size = _net.in_size();
+		const auto in_item_size = static_cast<int>(in_size.xyz.coord_prod());
+		const auto ref_item_size = static_cast<int>(_net.out_size().xyz.coord_prod());
+
+		if (stride < 1 || series_size % in_item_size != 0 || ref_series_size % ref_item_size != 0)
+			throw std::exception("Invalid input.");
+
+		const auto time_point_count = series_size / in_item_size;
+
+		if (time_point_count != ref_series_size / ref_item_size || time_point_count < in_size.w)
+			throw std::exception("Invalid input.");
+
+		return static_cast<int>((time_point_count - in_size.w) / stride + 1);
+	}
+
+	void RNN::train_series(const int series_size, const double* input_series, const int ref_series_size,
+		const double* reference_series, const int stride, const double learning_rate)
+	{
+		const auto window_count = calc_window_count(series_size, ref_series_size, stride);
+		check_scratch_limit(window_count);
+		const auto in_size = _net.in_size();
+		const auto out_size = _net.out_size();
+
+		std::lock_guard train_lock(_train_mutex);
+		_train_input.resize(window_count);
+		_train_reference.resize(window_count);
+
+		{
+			BANALYZER_SCOPED_TIMER(_stats.conversion_time_ns);
+			BANALYZER_COUNT(_stats.converted_byte_count, (series_size + ref_series_size) * sizeof(double));
+
+			for (auto window_id = 0; window_id < window_count; ++window_id)
+			{
+				const auto first_point_id = static_cast<std::size_t>(window_id) * stride;
+				auto& in = _train_input[window_id];
+				in.resize(in_size.w);
+				DataConversionUtils::fill_lazy_vector(in_size.xyz.coord_prod(),
+					input_series + first_point_id * in_size.xyz.coord_prod(), in);
+
+				auto& ref = _train_reference[window_id];
+				ref.resize(out_size.w);
+				DataConversionUtils::fill_lazy_vector(out_size.xyz.coord_prod(),
+					reference_series + first_point_id * out_size.xyz.coord_prod(), ref);
+			}
+		}
+
+		learn_converted(learning_rate);
+	}
+
+	std::vector<RNN::SequenceWindow> RNN::split_sequences(const int sequence_count, const int* sequence_lengths,
+		const int series_size, const int ref_series_size, const int truncation_length) const
+	{
+		const auto time_depth = static_cast<int>(_net.in_size().w);
+		const auto in_item_size = static_cast<long long>(_net.in_size().xyz.coord_prod());
+		const auto ref_item_size = static_cast<long long>(_net.out_size().xyz.coord_prod());
+
+		if (sequence_count < 1 || !sequence_lengths || truncation_length < 0 || truncation_length > time_depth)
+			throw std::exception("Invalid input.");
+
+		const auto step = truncation_length == 0 ? time_depth : truncation_length;
+		std::vector<SequenceWindow> result{};
+		auto sequence_begin = 0ll;
+
+		for (auto sequence_id = 0; sequence_id < sequence_count; ++sequence_id)
+		{
+			const auto length = sequence_lengths[sequence_id];
+
+			if (length < 1)
+				throw std::exception("Invalid input.");
+
+			if (length <= time_depth)
+				result.push_back({ sequence_begin, time_depth - length, time_depth - length });
+			else
+			{
+				result.push_back({ sequence_begin, 0, 0 });
+
+				for (auto covered = time_depth; covered < length;)
+				{
+					const auto end = std::min(covered + step, length);
+					result.push_back({ sequence_begin + end - time_depth, 0, time_depth - (end - covered) });
+					covered = end;
+				}
+			}
+
+			sequence_begin += length;
+		}
+
+		if (sequence_begin * in_item_size != series_size || sequence_begin * ref_item_size != ref_series_size)
+			throw std::exception("Invalid input.");
+
+		return result;
+	}
+
+	void RNN::mask_references(const std::vector<SequenceWindow>& windows)
+	{
+		const ObjectPool<EvalContext>::Lease context(_eval_context_pool);
+
+		for (auto window_id = 0ull; window_id < windows.size(); ++window_id)
+		{
+			const auto masked = windows[window_id].masked;
+
+			if (masked == 0)
+				continue;
+
+			// Zero difference between the output and the reference means zero gradient
+			// for both the cross-entropy and the squared error cost functions.
+			evaluate(_train_input[window_id], context->cache);
+			const auto& out = context->cache.out();
+			auto& ref = _train_reference[window_id];
+
+			for (auto item_id = 0; item_id < masked; ++item_id)
+				ref[item_id] = out[item_id];
+		}
+	}
+
+	void RNN::train_sequences(const int sequence_count, const int* sequence_lengths, const int series_size,
+		const double* input_series, const int ref_series_size, const double* reference_series,
+		const int truncation_length, const double learning_rate)
+	{
+		const auto windows = split_sequences(sequence_count, sequence_lengths, series_size,
+			ref_series_size, truncation_length);
+		const auto window_count = static_cast<int>(windows.size());
+		check_scratch_limit(window_count);
+		const auto in_size = _net.in_size();
+		const auto in_item_size = in_size.xyz.coord_prod();
+		const auto ref_item_size = _net.out_size().xyz.coord_prod();
+		const std::vector<double> zeros(std::max(in_item_size, ref_item_size));
+
+		std::lock_guard train_lock(_train_mutex);
+		_train_input.resize(window_count);
+		_train_reference.resize(window_count);
+
+		{
+			BANALYZER_SCOPED_TIMER(_stats.conversion_time_ns);
+			BANALYZER_COUNT(_stats.converted_byte_count, (series_size + ref_series_size) * sizeof(double));
+
+			for (auto window_id = 0; window_id < window_count; ++window_id)
+			{
+				const auto& window = windows[window_id];
+				auto& in = _train_input[window_id];
+				auto& ref = _train_reference[window_id];
+				in.resize(in_size.w);
+				ref.resize(in_size.w);
+
+				for (auto item_id = 0; item_id < in_size.w; ++item_id)
+				{
+					const auto point_id = window.first_point_id + item_id - window.padding;
+					const auto padded = item_id < window.padding;
+					DataConversionUtils::fill_tensor(in_item_size,
+						padded ? zeros.data() : input_series + point_id * in_item_size, in[item_id]);
+					DataConversionUtils::fill_tensor(ref_item_size,
+						padded ? zeros.data() : reference_series + point_id * ref_item_size, ref[item_id]);
+				}
+			}
+		}
+
+		mask_references(windows);
+		learn_converted(learning_rate);
+	}
+
+	FitResult RNN::fit_series(const int series_size, const double* input_series, const int ref_series_size,
+		const double* reference_series, const int stride, const FitOptions& options)
+	{
+		const auto window_count = calc_window_count(series_size, ref_series_size, stride);
+		const auto in_size = _net.in_size();
+		const auto out_size = _net.out_size();
+
+		return fit_impl(window_count, options, [&](const int window_id, LazyVector<CpuDC::tensor_t>& in, LazyVector<CpuDC::tensor_t>& ref)
+			{
+				const auto first_point_id = static_cast<std::size_t>(window_id) * stride;
+				in.resize(in_size.w);
+				DataConversionUtils::fill_lazy_vector(in_size.xyz.coord_prod(),
+					input_series + first_point_id * in_size.xyz.coord_prod(), in);
+				ref.resize(out_size.w);
+				DataConversionUtils::fill_lazy_vector(out_size.xyz.coord_prod(),
+					reference_series + first_point_id * out_size.xyz.coord_prod(), ref);
+			}, {}, {});
+	}
+
+	MNet<CpuDC>::Context& RNN::calc_gradient_parallel(const int pair_count, const CostFunction<CpuDC::tensor_t>& cost_func)
+	{
+		const auto shard_count = std::max(std::min(_thread_count, pair_count), 1);
+
+		while (_worker_contexts.size() < static_cast<std::size_t>(shard_count))
+			_worker_contexts.push_back(_net.allocate_context());
+
+		{
+			BANALYZER_SCOPED_TIMER(_stats.gradient_time_ns);
+			// Gradient calculation only reads the weights, so evaluation can go on meanwhile.
+			std::shared_lock weights_lock(_weights_mutex);
+
+			ThreadPool::shared().parallel_for(shard_count, [&](const int shard_id)
+				{
+					auto& context = _worker_contexts[shard_id];
+					context.reset_gradient();
+
+					const auto begin_pair_id = pair_count * shard_id / shard_count;
+					const auto end_pair_id = pair_count * (shard_id + 1) / shard_count;
+
+					for (auto pair_id = begin_pair_id; pair_id < end_pair_id; ++pair_id)
+						_net.calc_gradient(_train_input[pair_id], _train_reference[pair_id], cost_func, context);
+				});
+		}
+
+		auto& total = _worker_contexts[0];
+
+		for (auto shard_id = 1; shard_id < shard_count; ++shard_id)
+			total.add_gradient(_worker_contexts[shard_id]);
+
+		return total;
+	}
+
+	void RNN::learn_parallel(const int pair_count, const CostFunction<CpuDC::tensor_t>& cost_func,
+		const double learning_rate)
+	{
+		auto& total = calc_gradient_parallel(pair_count, cost_func);
+
+		BANALYZER_SCOPED_TIMER(_stats.update_time_ns);
+		std::unique_lock weights_lock(_weights_mutex);
+		_net.update(total, static_cast<Real>(learning_rate / pair_count));
+	}
+
+	void RNN::learn_optimized(const int pair_count, const CostFunction<CpuDC::tensor_t>& cost_func,
+		const double learning_rate)
+	{
+		auto& gradient = calc_gradient_parallel(pair_count, cost_func);
+		const auto accumulate = _optimizer_options.accumulation_steps > 1;
+
+		if (accumulate)
+		{
+			if (!_accumulated_gradient)
+			{
+				_accumulated_gradient = _net.allocate_context();
+				_accumulated_gradient->reset_gradient();
+				BANALYZER_COUNT(_stats.allocation_count, 1);
+			}
+
+			_accumulated_gradient->add_gradient(gradient);
+			_accumulated_pair_count += pair_count;
+
+			if (++_accumulated_call_count < _optimizer_options.accumulation_steps)
+				return;
+		}
+
+		auto& total = accumulate ? *_accumulated_gradient : gradient;
+		const auto total_pair_count = accumulate ? _accumulated_pair_count : pair_count;
+
+		{
+			BANALYZER_SCOPED_TIMER(_stats.update_time_ns);
+			std::unique_lock weights_lock(_weights_mutex);
+
+			if (_optimizer)
+				_optimizer->step(_net, total, 1.0 / total_pair_count, learning_rate);
+			else
+				_net.update(total, static_cast<Real>(learning_rate / total_pair_count));
+		}
+
+		if (accumulate)
+		{
+			_accumulated_gradient->reset_gradient();
+			_accumulated_call_count = 0;
+			_accumulated_pair_count = 0;
+		}
+	}
+
+	namespace
+	{
+		/// <summary>
+		/// Returns total size (in bytes) of the data of the given tensors.
+		/// </summary>
+		std::size_t calc_byte_size(const LazyVector<CpuDC::tensor_t>& tensors)
+		{
+			std::size_t result = 0;
+
+			for (const auto& tensor : tensors)
+				result += tensor.size() * sizeof(Real);
+
+			return result;
+		}
+
+		/// <summary>
+		/// Resizes the given collection so that it contains <paramref name="item_count"/> tensors of the given size.
+		/// </summary>
+		void presize(LazyVector<CpuDC::tensor_t>& tensors, const long long item_count, const long long item_size)
+		{
+			tensors.resize(item_count);
+
+			for (auto& tensor : tensors)
+				if (static_cast<long long>(tensor.size()) != item_size)
+					tensor.resize(1, 1, item_size);
+		}
+	}
+
+	void RNN::check_scratch_limit(const int pair_count) const
+	{
+		const auto pair_byte_size = static_cast<std::size_t>(_plain_input_size + _plain_output_size) * sizeof(Real);
+
+		if (_scratch_limit > 0 && static_cast<std::size_t>(pair_count) * pair_byte_size > _scratch_limit)
+			throw std::exception("Training batch exceeds the scratch limit.");
+	}
+
+	void RNN::reserve_scratch(const int max_batch_size, const int eval_context_count)
+	{
+		if (max_batch_size < 0 || eval_context_count < 0)
+			throw std::exception("Invalid scratch size.");
+
+		check_scratch_limit(max_batch_size);
+
+		const auto in_size = _net.in_size();
+		const auto out_size = _net.out_size();
+
+		{
+			std::lock_guard train_lock(_train_mutex);
+
+			if (_frozen && max_batch_size > 0)
+				throw std::exception("The net is frozen.");
+
+			_train_input.resize(max_batch_size);
+			_train_reference.resize(max_batch_size);
+
+			_prefetch_input.resize(max_batch_size);
+			_prefetch_reference.resize(max_batch_size);
+
+			for (auto pair_id = 0; pair_id < max_batch_size; ++pair_id)
+			{
+				presize(_train_input[pair_id], in_size.w, in_size.xyz.coord_prod());
+				presize(_train_reference[pair_id], out_size.w, out_size.xyz.coord_prod());
+				presize(_prefetch_input[pair_id], in_size.w, in_size.xyz.coord_prod());
+				presize(_prefetch_reference[pair_id], out_size.w, out_size.xyz.coord_prod());
+			}
+
+			if (max_batch_size > 0)
+				ensure_training_context();
+
+			while (_thread_count > 1 && _worker_contexts.size() < static_cast<std::size_t>(_thread_count))
+				_worker_contexts.push_back(_net.allocate_context());
+		}
+
+		_eval_context_pool.reserve(eval_context_count, [&](EvalContext& context)
+			{
+				presize(context.input, in_size.w, in_size.xyz.coord_prod());
+				presize(context.reference, out_size.w, out_size.xyz.coord_prod());
+				// A forward pass makes the net allocate its output in the context.
+				evaluate(context.input, context.cache);
+			});
+	}
+
+	std::size_t RNN::scratch_footprint() const
+	{
+		std::size_t result = 0;
+
+		{
+			std::lock_guard train_lock(_train_mutex);
+
+			for (const auto& item : _train_input)
+				result += calc_byte_size(item);
+
+			for (const auto& item : _train_reference)
+				result += calc_byte_size(item);
+
+			for (const auto& item : _prefetch_input)
+				result += calc_byte_size(item);
+
+			for (const auto& item : _prefetch_reference)
+				result += calc_byte_size(item);
+		}
+
+		_eval_context_pool.for_each_free([&](const EvalContext& context)
+			{
+				result += calc_byte_size(context.input) + calc_byte_size(context.cache.out()) +
+					calc_byte_size(context.reference);
+			});
+
+		return result;
+	}
+
+	void RNN::set_scratch_limit(const std::size_t limit_bytes)
+	{
+		std::lock_guard train_lock(_train_mutex);
+		_scratch_limit = limit_bytes;
+	}
+
+	std::size_t RNN::scratch_limit() const
+	{
+		return _scratch_limit;
+	}
+
+	void RNN::set_thread_count(const int thread_count)
+	{
+		if (thread_count < 1)
+			throw std::exception("Invalid number of threads.");
+
+		std::lock_guard train_lock(_train_mutex);
+		_thread_count = thread_count;
+	}
+
+	int RNN::thread_count() const
+	{
+		return _thread_count;
+	}
+
+	void RNN::set_optimizer(const OptimizerOptions& options)
+	{
+		NetOptimizer optimizer(options); // validates the options
+
+		std::lock_guard train_lock(_train_mutex);
+		_optimizer_options = options;
+
+		if (static_cast<RnnOptimizer>(options.optimizer) == RnnOptimizer::Sgd)
+			_optimizer.reset();
+		else
+			_optimizer = std::move(optimizer);
+
+		_accumulated_gradient.reset();
+		_accumulated_call_count = 0;
+		_accumulated_pair_count = 0;
+	}
+
+	OptimizerOptions RNN::optimizer_options() const
+	{
+		std::lock_guard train_lock(_train_mutex);
+		return _optimizer_options;
+	}
+
+	RnnCost RNN::cost() const
+	{
+		return _cost;
+	}
+
+	void RNN::freeze()
+	{
+		std::lock_guard train_lock(_train_mutex);
+		_frozen = true;
+		_context.reset();
+		_worker_contexts = {};
+		_train_input = {};
+		_train_reference = {};
+		_prefetch_input = {};
+		_prefetch_reference = {};
+		_optimizer.reset();
+		_accumulated_gradient.reset();
+	}
+
+	bool RNN::is_frozen() const
+	{
+		std::lock_guard train_lock(_train_mutex);
+		return _frozen;
 	}
 
 	Index4d RNN::in_size() const
@@ -115,8 +1122,106 @@ namespace BAnalyzerNative
 		return _net.out_size();
 	}
 
+	Instrumentation& RNN::stats() const
+	{
+		return _stats;
+	}
+
 	int RNN::layer_count() const
 	{
 		return static_cast<int>(_net.layer_count());
 	}
+
+	void RNN::save(const std::filesystem::path& file_path, const WeightPrecision precision) const
+	{
+		msgpack::sbuffer buffer;
+
+		{
+			std::shared_lock lock(_weights_mutex);
+			msgpack::pack(buffer, _net);
+		}
+
+		const auto compressed_weights = precision == WeightPrecision::Full ? std::vector<char>{} :
+			CheckpointCompression::compress(buffer.data(), buffer.size(), precision);
+		const auto weights_data = precision == WeightPrecision::Full ? buffer.data() : compressed_weights.data();
+		const auto weights_size = precision == WeightPrecision::Full ? buffer.size() : compressed_weights.size();
+
+		const CheckpointHeader header{ CheckpointSignature, CheckpointVersion, static_cast<std::uint32_t>(sizeof(Real)),
+			_time_depth, static_cast<std::int32_t>(_layer_item_sizes.size()), static_cast<std::uint32_t>(_cost),
+			weights_size, static_cast<std::uint32_t>(precision), 0 };
+
+		std::ofstream file(file_path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+		if (!file)
+			throw std::exception("Can't open the file for writing.");
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(reinterpret_cast<const char*>(_layer_item_sizes.data()),
+			static_cast<std::streamsize>(_layer_item_sizes.size() * sizeof(std::int32_t)));
+		file.write(weights_data, static_cast<std::streamsize>(weights_size));
+
+		if (!file)
+			throw std::exception("Failed to write the file.");
+	}
+
+	std::unique_ptr<RNN> RNN::load(const std::filesystem::path& file_path)
+	{
+		const MappedFile file(file_path);
+		const auto data = static_cast<const char*>(file.data());
+
+		if (file.size() < CheckpointHeaderV1Size)
+			throw std::exception("Invalid file of a net.");
+
+		CheckpointHeader header{};
+		std::memcpy(&header, data, CheckpointHeaderV1Size);
+
+		if (header.signature != CheckpointSignature || header.version < 1 || header.version > CheckpointVersion)
+			throw std::exception("Unsupported format of the file of a net.");
+
+		const auto header_size = header.version == 1 ? CheckpointHeaderV1Size : sizeof(CheckpointHeader);
+
+		if (file.size() < header_size)
+			throw std::exception("Invalid file of a net.");
+
+		std::memcpy(&header, data, header_size);
+
+		if (header.real_size != sizeof(Real))
+			throw std::exception("The net was saved with a different precision.");
+
+		const auto precision = static_cast<WeightPrecision>(header.weight_precision);
+
+		if (precision != WeightPrecision::Full && precision != WeightPrecision::Half && precision != WeightPrecision::Int8)
+			throw std::exception("Unsupported precision of weights.");
+
+		const auto sizes_offset = header_size;
+		const auto sizes_byte_count = static_cast<std::size_t>(std::max(header.layer_item_sizes_count, 0)) * sizeof(std::int32_t);
+		const auto weights_offset = sizes_offset + sizes_byte_count;
+
+		if (header.layer_item_sizes_count < 2 || file.size() < weights_offset ||
+			file.size() - weights_offset != header.weights_size)
+			throw std::exception("Invalid file of a net.");
+
+		std::vector<int> layer_item_sizes(header.layer_item_sizes_count);
+		std::memcpy(layer_item_sizes.data(), data + sizes_offset, sizes_byte_count);
+
+		auto result = std::make_unique<RNN>(header.time_depth, header.layer_item_sizes_count, layer_item_sizes.data(),
+			nullptr, static_cast<RnnCost>(header.cost));
+
+		if (precision == WeightPrecision::Full)
+		{
+			const auto handle = msgpack::unpack(data + weights_offset, static_cast<std::size_t>(header.weights_size));
+			handle.get().convert(result->_net);
+		} else
+		{
+			const auto weights = CheckpointCompression::decompress(data + weights_offset, static_cast<std::size_t>(header.weights_size));
+			const auto handle = msgpack::unpack(weights.data(), weights.size());
+			handle.get().convert(result->_net);
+		}
+
+		if (result->_net.in_size() != Index4d{ {1, 1, layer_item_sizes.front()}, header.time_depth } ||
+			result->_net.out_size() != Index4d{ {1, 1, layer_item_sizes.back()}, header.time_depth })
+			throw std::exception("The weights do not match the header of the file.");
+
+		return result;
+	}
 }
@@ -18,19 +18,289 @@
 #pragma once
 #include "NeuralNet/DataContext.h"
 #include "NeuralNet/MNet.h"
+#include "NeuralNet/InOutMData.h"
+#include "FitOptions.h"
+#include "Instrumentation.h"
+#include "NetOptimizer.h"
+#include "ObjectPool.h"
+#include "OptimizerOptions.h"
+#include "RnnFunctions.h"
+#include "CheckpointCompression.h"
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <stop_token>
+#include <vector>
 
 namespace BAnalyzerNative
 {
 	/// <summary>
 	/// A wrapper for an instance of MNet.
+	/// Concurrency model: all the "evaluate" methods can be called simultaneously from any number of threads
+	/// (each call uses its own evaluation context) and only share the weights of the net for reading;
+	/// "train" calls are serialized and acquire exclusive access to the weights only for the update itself (after
+	/// the training data is converted and the gradient is calculated under shared access to the weights),
+	/// i.e., the update waits for the evaluations that are in progress
+	/// and the evaluations that start after it wait until the weights are updated.
 	/// </summary>
 	class RNN
 	{
+	public:
+
+		/// <summary>
+		/// Scratch data needed to evaluate the net.
+		/// An instance must not be used by several threads simultaneously.
+		/// </summary>
+		struct EvalContext
+		{
+			/// <summary>
+			/// Converted input of the net.
+			/// </summary>
+			DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t> input{};
+
+			/// <summary>
+			/// Output of the net.
+			/// </summary>
+			DeepLearning::InOutMData<DeepLearning::CpuDC> cache{};
+
+			/// <summary>
+			/// Converted reference (used when the cost of the net is evaluated).
+			/// </summary>
+			DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t> reference{};
+		};
+
+	private:
+
 		DeepLearning::MNet<DeepLearning::CpuDC> _net{};
-		DeepLearning::MNet<DeepLearning::CpuDC>::Context _context{};
+
+		/// <summary>
+		/// Training context; allocated by the first training call (or "reserve_scratch"), so that the nets
+		/// that are only evaluated (e.g., the loaded ones) do not hold it.
+		/// </summary>
+		std::optional<DeepLearning::MNet<DeepLearning::CpuDC>::Context> _context{};
+
 		int _plain_input_size{ -1 };
 		int _plain_output_size{ -1 };
 
+		/// <summary>
+		/// Parameters the net was constructed with (needed to persist the net).
+		/// </summary>
+		int _time_depth{};
+		std::vector<int> _layer_item_sizes{};
+
+		/// <summary>
+		/// Cost function the net is trained with.
+		/// </summary>
+		RnnCost _cost{ RnnCost::CrossEntropy };
+
+		/// <summary>
+		/// "True" if the training context and data are released (see "freeze").
+		/// </summary>
+		bool _frozen{};
+
+		/// <summary>
+		/// Guards the weights of the net: shared for evaluation, exclusive for training.
+		/// </summary>
+		mutable std::shared_mutex _weights_mutex{};
+
+		/// <summary>
+		/// Evaluation contexts to be reused by the callers that do not provide their own ones.
+		/// </summary>
+		mutable ObjectPool<EvalContext> _eval_context_pool{};
+
+		/// <summary>
+		/// Serializes training calls (guards the converted training data below).
+		/// </summary>
+		mutable std::mutex _train_mutex{};
+
+		/// <summary>
+		/// Converted training data.
+		/// </summary>
+		DeepLearning::LazyVector<DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t>> _train_input{};
+		DeepLearning::LazyVector<DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t>> _train_reference{};
+
+		/// <summary>
+		/// Converted mini-batch to be trained next (filled in the background while the current one is trained, see "fit").
+		/// </summary>
+		DeepLearning::LazyVector<DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t>> _prefetch_input{};
+		DeepLearning::LazyVector<DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t>> _prefetch_reference{};
+
+		/// <summary>
+		/// Number of shards a training batch is split into (each shard is processed by its own worker thread).
+		/// </summary>
+		int _thread_count{ 1 };
+
+		/// <summary>
+		/// Training contexts of the worker threads (used when the number of threads is greater than one).
+		/// </summary>
+		std::vector<DeepLearning::MNet<DeepLearning::CpuDC>::Context> _worker_contexts{};
+
+		/// <summary>
+		/// Parameters of the optimizer the net is trained with.
+		/// </summary>
+		OptimizerOptions _optimizer_options{};
+
+		/// <summary>
+		/// State of the adaptive optimizer (empty for the plain SGD).
+		/// </summary>
+		std::optional<NetOptimizer> _optimizer{};
+
+		/// <summary>
+		/// Gradient accumulated over the training calls since the last update of the weights
+		/// (used when the number of accumulation steps is greater than one).
+		/// </summary>
+		std::optional<DeepLearning::MNet<DeepLearning::CpuDC>::Context> _accumulated_gradient{};
+
+		/// <summary>
+		/// Number of training calls and pairs the accumulated gradient is summed over.
+		/// </summary>
+		int _accumulated_call_count{};
+		long long _accumulated_pair_count{};
+
+		/// <summary>
+		/// Upper bound (in bytes) of the converted training data of a single batch; "0" means "no limit".
+		/// </summary>
+		std::size_t _scratch_limit{};
+
+		/// <summary>
+		/// Hot-path counters of the net.
+		/// </summary>
+		mutable Instrumentation _stats{};
+
+		/// <summary>
+		/// Throws exception if the converted training data of a batch of the given size would exceed the scratch limit.
+		/// </summary>
+		void check_scratch_limit(const int pair_count) const;
+
+		/// <summary>
+		/// Validates sizes of the given training aggregates and returns number of training pairs they represent.
+		/// </summary>
+		int calc_training_pair_count(const int in_aggregate_size, const int ref_aggregate_size) const;
+
+		/// <summary>
+		/// Converts the given <paramref name="pair_count"/> input-reference pairs into the given containers.
+		/// </summary>
+		/// <typeparam name="T">Type of the plain array elements ("double" or "float").</typeparam>
+		template <class T>
+		void convert_training_data(const int pair_count, const T* input_aggregate, const T* reference_aggregate,
+			DeepLearning::LazyVector<DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t>>& input_dest,
+			DeepLearning::LazyVector<DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t>>& reference_dest) const;
+
+		/// <summary>
+		/// Implementation of the batch evaluation with the given evaluation context.
+		/// </summary>
+		/// <typeparam name="T">Type of the plain array elements ("double" or "float").</typeparam>
+		template <class T>
+		int evaluate_batch_impl(const int in_aggregate_size, const T* input_aggregate,
+			const int output_capacity, T* output_aggregate, EvalContext& context) const;
+
+		/// <summary>
+		/// Performs a training iteration on the converted training data (must be called under the training lock).
+		/// </summary>
+		void learn_converted(const double learning_rate);
+
+		/// <summary>
+		/// Allocates the training context if it is not allocated yet (must be called under the training lock).
+		/// </summary>
+		void ensure_training_context();
+
+		/// <summary>
+		/// Returns cost function value (average per element) of the net on the pairs in
+		/// [<paramref name="begin_pair_id"/>, <paramref name="end_pair_id"/>) provided by the given loader.
+		/// </summary>
+		/// <typeparam name="L">Callable "(pair_id, input, reference)" that fills the given containers with the given pair.</typeparam>
+		template <class L>
+		double calc_cost(const int begin_pair_id, const int end_pair_id, const L& load_pair) const;
+
+		/// <summary>
+		/// Implementation of "calc_cost" specialized for the cost function <typeparamref name="C"/>
+		/// (the cost function is dispatched once per call rather than per element).
+		/// </summary>
+		template <RnnCost C, class L>
+		double calc_cost_impl(const int begin_pair_id, const int end_pair_id, const L& load_pair) const;
+
+		/// <summary>
+		/// Implementation of the multi-epoch training (see "fit") on <paramref name="pair_count"/>
+		/// training pairs provided by the given loader; only the pairs of the current mini-batch (and the next one, which is
+		/// converted in the background meanwhile) are kept converted. The loader must be callable from any thread.
+		/// </summary>
+		/// <typeparam name="L">Callable "(pair_id, input, reference)" that fills the given containers with the given pair.</typeparam>
+		template <class L>
+		FitResult fit_impl(const int pair_count, const FitOptions& options, const L& load_pair,
+			const EpochCallback& on_epoch, const std::stop_token& stop_token);
+
+		/// <summary>
+		/// Validates sizes of the given input and reference series and returns number of the windows
+		/// of the time depth of the net taken with the given <paramref name="stride"/> (in time-points)
+		/// that fit into the series.
+		/// </summary>
+		int calc_window_count(const int series_size, const int ref_series_size, const int stride) const;
+
+		/// <summary>
+		/// A window of the time depth of the net taken from a sequence (see "train_sequences").
+		/// </summary>
+		struct SequenceWindow
+		{
+			/// <summary>
+			/// Index of the first time-point of the window in the series the sequences are stored in.
+			/// </summary>
+			long long first_point_id{};
+
+			/// <summary>
+			/// Number of the leading (zero) time-points the window is padded with (for the sequences shorter than the net).
+			/// </summary>
+			int padding{};
+
+			/// <summary>
+			/// Number of the leading time-points of the window whose outputs do not contribute to the cost
+			/// (the padding and the time-points already trained with the previous window of the sequence).
+			/// </summary>
+			int masked{};
+		};
+
+		/// <summary>
+		/// Validates sizes of the given series and splits the sequences of the given lengths stored in them one after another
+		/// into windows of the time depth of the net, such that each time-point of a sequence has its output trained exactly
+		/// once and the windows of a sequence are at most <paramref name="truncation_length"/> time-points apart.
+		/// </summary>
+		std::vector<SequenceWindow> split_sequences(const int sequence_count, const int* sequence_lengths,
+			const int series_size, const int ref_series_size, const int truncation_length) const;
+
+		/// <summary>
+		/// Replaces the masked reference items of the converted training pairs with the corresponding outputs
+		/// of the net, so that they do not contribute to the gradient.
+		/// </summary>
+		void mask_references(const std::vector<SequenceWindow>& windows);
+
+		/// <summary>
+		/// Performs a training iteration on the first <paramref name="pair_count"/> items of the converted training data
+		/// splitting them into shards processed in parallel. Gradients of the shards are accumulated in the contexts
+		/// of the corresponding workers and then reduced before the weights are updated.
+		/// </summary>
+		void learn_parallel(const int pair_count,
+			const DeepLearning::CostFunction<DeepLearning::CpuDC::tensor_t>& cost_func, const double learning_rate);
+
+		/// <summary>
+		/// Calculates gradient of the cost function summed over the first <paramref name="pair_count"/> items of
+		/// the converted training data (split into shards processed in parallel) and returns the context holding it.
+		/// </summary>
+		DeepLearning::MNet<DeepLearning::CpuDC>::Context& calc_gradient_parallel(const int pair_count,
+			const DeepLearning::CostFunction<DeepLearning::CpuDC::tensor_t>& cost_func);
+
+		/// <summary>
+		/// Performs a training iteration on the first <paramref name="pair_count"/> items of the converted training data
+		/// with the current optimizer; the weights are updated only each "accumulation steps"-th call
+		/// with the gradient accumulated since the previous update.
+		/// </summary>
+		void learn_optimized(const int pair_count,
+			const DeepLearning::CostFunction<DeepLearning::CpuDC::tensor_t>& cost_func, const double learning_rate);
+
+		/// <summary>
+		/// Validates the given size of an input aggregate and returns size of the corresponding output aggregate.
+		/// </summary>
+		int calc_output_aggregate_size(const int in_aggregate_size) const;
+
 	public:
 
 		/// <summary>
@@ -40,7 +310,11 @@ namespace BAnalyzerNative
 		/// <param name="layer_item_sizes_count">Number of items in the array <paramref name="layer_item_sizes"/> </param>
 		/// <param name="layer_item_sizes">An array containing linear sizes of time-point input items for each layer as wel as the
 		/// size of time-point output item for the last layer at the end of the array.</param>
-		RNN(const int time_depth, const int layer_item_sizes_count, const int* layer_item_sizes);
+		/// <param name="activations">Activation functions of the layers ("layer_item_sizes_count - 1" items)
+		/// or "null" if all the layers should use sigmoid.</param>
+		/// <param name="cost">Cost function the net is trained with.</param>
+		RNN(const int time_depth, const int layer_item_sizes_count, const int* layer_item_sizes,
+			const RnnActivation* activations = nullptr, const RnnCost cost = RnnCost::CrossEntropy);
 
 		/// <summary>
 		/// Evaluates net at the given <paramref name="input"/> and stores the
@@ -51,6 +325,78 @@ namespace BAnalyzerNative
 		/// <param name="output">Container to store the result.</param>
 		void evaluate(const int size, const double* input, DeepLearning::LazyVector<double>& output) const;
 
+		/// <summary>
+		/// Evaluates net at the given <paramref name="input"/> and writes the
+		/// result into the given caller-provided <paramref name="output"/> buffer.
+		/// Returns number of elements written to the buffer.
+		/// </summary>
+		/// <param name="size">Size of the <paramref name="input"/> </param>
+		/// <param name="input">Input</param>
+		/// <param name="output_capacity">Number of elements that can be written to <paramref name="output"/>.</param>
+		/// <param name="output">Buffer to store the result.</param>
+		int evaluate(const int size, const double* input, const int output_capacity, double* output) const;
+
+		/// <summary>
+		/// Evaluates net at each of the input items packed into the given <paramref name="input_aggregate"/>
+		/// (the packing is the same as the one expected by the "train" method) and stores the
+		/// concatenation of the corresponding results into the given <paramref name="output_aggregate"/> container.
+		/// </summary>
+		/// <param name="in_aggregate_size">Total number of elements in <paramref name="input_aggregate"/> array.</param>
+		/// <param name="input_aggregate">Array of input data.</param>
+		/// <param name="output_aggregate">Container to store the result.</param>
+		void evaluate_batch(const int in_aggregate_size, const double* input_aggregate,
+			DeepLearning::LazyVector<double>& output_aggregate) const;
+
+		/// <summary>
+		/// Batch version of the evaluation into a caller-provided buffer (see the corresponding "evaluate" method).
+		/// Returns number of elements written to <paramref name="output_aggregate"/>.
+		/// </summary>
+		/// <param name="in_aggregate_size">Total number of elements in <paramref name="input_aggregate"/> array.</param>
+		/// <param name="input_aggregate">Array of input data.</param>
+		/// <param name="output_capacity">Number of elements that can be written to <paramref name="output_aggregate"/>.</param>
+		/// <param name="output_aggregate">Buffer to store the result.</param>
+		int evaluate_batch(const int in_aggregate_size, const double* input_aggregate,
+			const int output_capacity, double* output_aggregate) const;
+
+		/// <summary>
+		/// The same as the corresponding "evaluate_batch" method above but uses the
+		/// given (caller-owned) evaluation <paramref name="context"/>.
+		/// </summary>
+		int evaluate_batch(const int in_aggregate_size, const double* input_aggregate,
+			const int output_capacity, double* output_aggregate, EvalContext& context) const;
+
+		/// <summary>
+		/// Single precision version of the corresponding "evaluate_batch" method (saves conversion of
+		/// the input and output data in case the net itself operates in single precision).
+		/// </summary>
+		int evaluate_batch(const int in_aggregate_size, const float* input_aggregate,
+			const int output_capacity, float* output_aggregate) const;
+
+		/// <summary>
+		/// Single precision version of the corresponding "evaluate_batch" method (saves conversion of
+		/// the input and output data in case the net itself operates in single precision).
+		/// </summary>
+		int evaluate_batch(const int in_aggregate_size, const float* input_aggregate,
+			const int output_capacity, float* output_aggregate, EvalContext& context) const;
+
+		/// <summary>
+		/// Returns a pointer to an evaluation context from the internal pool of the net.
+		/// The context is exclusively owned by the caller until it is returned with "release_context".
+		/// </summary>
+		EvalContext* acquire_context() const;
+
+		/// <summary>
+		/// Returns the given evaluation <paramref name="context"/> (acquired with "acquire_context") back to the pool.
+		/// </summary>
+		void release_context(EvalContext* context) const;
+
+		/// <summary>
+		/// Evaluates net at the given (already converted) <paramref name="input"/> and
+		/// stores the result into the given <paramref name="result"/> container.
+		/// </summary>
+		void evaluate(const DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t>& input,
+			DeepLearning::InOutMData<DeepLearning::CpuDC>& result) const;
+
 		/// <summary>
 		/// Performs a single-batch training iteration based on the given set of input-reference data.
 		/// </summary>
@@ -62,6 +408,159 @@ namespace BAnalyzerNative
 		void train(const int in_aggregate_size, const double* input_aggregate, const int ref_aggregate_size,
 			const double* reference_aggregate, const double learning_rate);
 
+		/// <summary>
+		/// Single precision version of the "train" method above (saves conversion of the training
+		/// data in case the net itself operates in single precision).
+		/// </summary>
+		void train(const int in_aggregate_size, const float* input_aggregate, const int ref_aggregate_size,
+			const float* reference_aggregate, const double learning_rate);
+
+		/// <summary>
+		/// Runs a multi-epoch training on the given data set (packed the same way as for the "train" method).
+		/// The training pairs are shuffled before each epoch and split into mini-batches according to the
+		/// given <paramref name="options"/>; only the pairs of the current mini-batch are kept converted.
+		/// Optionally, a part of the data set is held out for validation and used for early stopping;
+		/// in this case the net ends up with the weights of the epoch with the lowest validation cost.
+		/// </summary>
+		/// <param name="in_aggregate_size">Total number of elements in <paramref name="input_aggregate"/> array.</param>
+		/// <param name="input_aggregate">Array of input data.</param>
+		/// <param name="ref_aggregate_size">Total number of elements in <paramref name="reference_aggregate"/> array.</param>
+		/// <param name="reference_aggregate">Array of reference data.</param>
+		/// <param name="options">Parameters of the training.</param>
+		/// <param name="on_epoch">Optional observer called after each epoch.</param>
+		/// <param name="stop_token">Token that allows to stop the training between mini-batches (without validation,
+		/// the weights keep the state after the last performed mini-batch).</param>
+		FitResult fit(const int in_aggregate_size, const double* input_aggregate, const int ref_aggregate_size,
+			const double* reference_aggregate, const FitOptions& options,
+			const EpochCallback& on_epoch = {}, const std::stop_token& stop_token = {});
+
+		/// <summary>
+		/// Performs a single-batch training iteration on all the windows of the given series. Windows have length equal
+		/// to the time depth of the net and start at each <paramref name="stride"/>-th time-point of the series.
+		/// The same windows of <paramref name="reference_series"/> serve as references.
+		/// Unlike with the "train" method, the overlapping time-points are passed (and marshalled) only once.
+		/// </summary>
+		/// <param name="series_size">Total number of elements in <paramref name="input_series"/> array.</param>
+		/// <param name="input_series">Time-point input items of the series (one after another).</param>
+		/// <param name="ref_series_size">Total number of elements in <paramref name="reference_series"/> array.</param>
+		/// <param name="reference_series">Time-point reference items of the series (one after another).</param>
+		/// <param name="stride">Number of time-points between the beginnings of the consecutive windows.</param>
+		/// <param name="learning_rate">Factor determining aggressiveness of the training.</param>
+		void train_series(const int series_size, const double* input_series, const int ref_series_size,
+			const double* reference_series, const int stride, const double learning_rate);
+
+		/// <summary>
+		/// Performs a single-batch training iteration on <paramref name="sequence_count"/> sequences of arbitrary lengths
+		/// stored one after another in the given series (truncated backpropagation through time).
+		/// A sequence shorter than the time depth of the net is padded with leading zero time-points whose outputs are masked out.
+		/// A longer one is split into windows of the time depth of the net that end every <paramref name="truncation_length"/>
+		/// time-points; the outputs of a window are trained only for its last time-points (not covered by the previous window),
+		/// the leading ones serve to warm up the state of the net and do not contribute to the cost.
+		/// Thus the gradients never propagate further than the time depth of the net, whatever the length of a sequence is.
+		/// </summary>
+		/// <param name="sequence_count">Number of items in <paramref name="sequence_lengths"/> array.</param>
+		/// <param name="sequence_lengths">Lengths (in time-points) of the sequences.</param>
+		/// <param name="series_size">Total number of elements in <paramref name="input_series"/> array.</param>
+		/// <param name="input_series">Time-point input items of the sequences (one after another).</param>
+		/// <param name="ref_series_size">Total number of elements in <paramref name="reference_series"/> array.</param>
+		/// <param name="reference_series">Time-point reference items of the sequences (one after another).</param>
+		/// <param name="truncation_length">Number of time-points between the ends of the consecutive windows of a sequence
+		/// (from "1" to the time depth of the net; "0" means the time depth of the net).</param>
+		/// <param name="learning_rate">Factor determining aggressiveness of the training.</param>
+		void train_sequences(const int sequence_count, const int* sequence_lengths, const int series_size,
+			const double* input_series, const int ref_series_size, const double* reference_series,
+			const int truncation_length, const double learning_rate);
+
+		/// <summary>
+		/// The same as "fit" but the training pairs are the windows of the given series (see "train_series").
+		/// The windows are converted only when their mini-batch is processed, so the memory
+		/// consumption scales with the length of the series rather than with the total size of the windows.
+		/// </summary>
+		FitResult fit_series(const int series_size, const double* input_series, const int ref_series_size,
+			const double* reference_series, const int stride, const FitOptions& options);
+
+		/// <summary>
+		/// Sets number of worker threads to be used by training; "1" corresponds to the sequential training.
+		/// </summary>
+		void set_thread_count(const int thread_count);
+
+		/// <summary>
+		/// Returns number of worker threads used by training.
+		/// </summary>
+		int thread_count() const;
+
+		/// <summary>
+		/// Sets the optimizer the net is to be trained with (by all the training methods). Resets state
+		/// of the previous optimizer and discards the gradient accumulated but not applied yet.
+		/// The "learning rate" of the training methods is the step size of the optimizer.
+		/// </summary>
+		void set_optimizer(const OptimizerOptions& options);
+
+		/// <summary>
+		/// Returns parameters of the optimizer the net is trained with.
+		/// </summary>
+		OptimizerOptions optimizer_options() const;
+
+		/// <summary>
+		/// Returns cost function the net is trained with.
+		/// </summary>
+		RnnCost cost() const;
+
+		/// <summary>
+		/// Turns the net into an inference-only one: releases the training context and the converted training data,
+		/// after which any training call fails with an exception. Evaluation is not affected.
+		/// </summary>
+		void freeze();
+
+		/// <summary>
+		/// Returns "true" if the net is frozen (see "freeze").
+		/// </summary>
+		bool is_frozen() const;
+
+		/// <summary>
+		/// Saves the net into the given file in a versioned binary format: a header containing
+		/// time depth, item sizes of the layers and precision of the net followed by the weights.
+		/// The weights can be stored with reduced <paramref name="precision"/> (half precision or 8-bit with
+		/// a scale factor per block of values, see "CheckpointCompression"), which makes the file smaller only:
+		/// the weights are expanded back to full precision on loading, so that nets loaded from such files
+		/// are lossy copies that can be evaluated and trained as usual.
+		/// </summary>
+		void save(const std::filesystem::path& file_path, const WeightPrecision precision = WeightPrecision::Full) const;
+
+		/// <summary>
+		/// Returns a net loaded from the given file (see "save").
+		/// The file is memory-mapped, so only the pages that are actually needed are read
+		/// and the OS file cache is shared by all the processes loading the same file.
+		/// Throws exception if the file is corrupted or was saved with a different precision.
+		/// </summary>
+		static std::unique_ptr<RNN> load(const std::filesystem::path& file_path);
+
+		/// <summary>
+		/// Pre-sizes the scratch data of the net so that the subsequent training calls with batches of up to
+		/// <paramref name="max_batch_size"/> pairs and up to <paramref name="eval_context_count"/> simultaneous
+		/// evaluations do not have to (re)allocate the converted data and the output of the net.
+		/// Only the buffers owned by the net are pre-sized: the layers of the net still allocate their
+		/// temporaries internally, so the training and evaluation calls are not allocation-free.
+		/// </summary>
+		void reserve_scratch(const int max_batch_size, const int eval_context_count);
+
+		/// <summary>
+		/// Returns total size (in bytes) of the scratch tensors currently held by the net: the converted training data
+		/// and the data of the pooled evaluation contexts (internal buffers of the layers are not included).
+		/// </summary>
+		std::size_t scratch_footprint() const;
+
+		/// <summary>
+		/// Sets upper bound (in bytes) of the converted training data of a single batch ("0" means "no limit").
+		/// Training (and reservation) calls exceeding the limit fail with an exception.
+		/// </summary>
+		void set_scratch_limit(const std::size_t limit_bytes);
+
+		/// <summary>
+		/// Returns upper bound (in bytes) of the converted training data of a single batch ("0" means "no limit").
+		/// </summary>
+		std::size_t scratch_limit() const;
+
 		/// <summary>
 		/// Returns input size of the net.
 		/// </summary>
@@ -72,6 +571,11 @@ namespace BAnalyzerNative
 		/// </summary>
 		DeepLearning::Index4d out_size() const;
 
+		/// <summary>
+		/// Returns hot-path counters of the net (counters are updated only if "BANALYZER_INSTRUMENTATION" is on).
+		/// </summary>
+		Instrumentation& stats() const;
+
 		/// <summary>
 		/// Returns number of layers constituting the net.
 		/// </summary>
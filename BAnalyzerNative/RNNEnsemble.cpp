@@ -0,0 +1,145 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "RNNEnsemble.h"
+#include "DataConversionUtils.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <numeric>
+
+using namespace DeepLearning;
+
+namespace BAnalyzerNative
+{
+	RNNEnsemble::RNNEnsemble(const int member_count, const RNN* const* members, const double* weights)
+	{
+		if (member_count < 1 || !members)
+			throw std::exception("Invalid members of the ensemble.");
+
+		_members.assign(members, members + member_count);
+
+		if (std::ranges::any_of(_members, [](const auto member) { return member == nullptr; }))
+			throw std::exception("Invalid members of the ensemble.");
+
+		_item_size = static_cast<int>(_members[0]->in_size().xyz.coord_prod());
+		_out_item_size = static_cast<int>(_members[0]->out_size().xyz.coord_prod());
+
+		for (auto member_id = 0; member_id < member_count; ++member_id)
+		{
+			const auto& member = *_members[member_id];
+
+			if (member.in_size().xyz.coord_prod() != _item_size || member.out_size().xyz.coord_prod() != _out_item_size)
+				throw std::exception("Members of the ensemble must have the same input and output item sizes.");
+
+			const auto depth = static_cast<int>(member.in_size().w);
+			const auto group_it = std::ranges::find(_groups, depth, &DepthGroup::depth);
+
+			if (group_it == _groups.end())
+				_groups.push_back(DepthGroup{ depth, { member_id } });
+			else
+				group_it->member_ids.push_back(member_id);
+		}
+
+		_depth = std::ranges::max(_groups, {}, &DepthGroup::depth).depth;
+
+		if (weights)
+			_weights.assign(weights, weights + member_count);
+		else
+			_weights.assign(member_count, 1.0);
+
+		const auto weight_sum = std::accumulate(_weights.begin(), _weights.end(), 0.0);
+
+		if (weight_sum <= 0 || std::ranges::any_of(_weights, [](const auto weight) { return weight < 0; }))
+			throw std::exception("Invalid weights of the members of the ensemble.");
+
+		for (auto& weight : _weights)
+			weight /= weight_sum;
+
+		_caches.resize(member_count);
+		_member_outputs.resize(static_cast<std::size_t>(member_count) * _out_item_size);
+	}
+
+	int RNNEnsemble::evaluate(const int size, const double* input, const int output_capacity, double* output,
+		const int member_output_capacity, double* member_outputs)
+	{
+		if (size != _depth * _item_size || !input)
+			throw std::exception("Invalid input data.");
+
+		if (output_capacity < _out_item_size || !output ||
+			(member_outputs && member_output_capacity < static_cast<int>(_member_outputs.size())))
+			throw std::exception("Insufficient output capacity.");
+
+		// The input is converted once per distinct depth: members of the same depth share the converted window.
+		for (auto& group : _groups)
+		{
+			group.input.resize(group.depth);
+			DataConversionUtils::fill_lazy_vector(_item_size,
+				input + static_cast<std::size_t>(_depth - group.depth) * _item_size, group.input);
+		}
+
+		const auto member_count = static_cast<int>(_members.size());
+		std::vector<const LazyVector<CpuDC::tensor_t>*> member_inputs(member_count);
+
+		for (const auto& group : _groups)
+			for (const auto member_id : group.member_ids)
+				member_inputs[member_id] = &group.input;
+
+		ThreadPool::shared().parallel_for(member_count, [&](const int member_id)
+			{
+				auto& cache = _caches[member_id];
+				_members[member_id]->evaluate(*member_inputs[member_id], cache);
+				const auto& out = cache.out();
+				DataConversionUtils::pack_tensor(out[out.size() - 1],
+					_member_outputs.data() + static_cast<std::size_t>(member_id) * _out_item_size);
+			});
+
+		std::fill(output, output + _out_item_size, 0.0);
+
+		for (auto member_id = 0; member_id < member_count; ++member_id)
+		{
+			const auto member_output = _member_outputs.data() + static_cast<std::size_t>(member_id) * _out_item_size;
+
+			for (auto item_id = 0; item_id < _out_item_size; ++item_id)
+				output[item_id] += _weights[member_id] * member_output[item_id];
+		}
+
+		if (member_outputs)
+			std::ranges::copy(_member_outputs, member_outputs);
+
+		return _out_item_size;
+	}
+
+	int RNNEnsemble::depth() const
+	{
+		return _depth;
+	}
+
+	int RNNEnsemble::input_item_size() const
+	{
+		return _item_size;
+	}
+
+	int RNNEnsemble::output_item_size() const
+	{
+		return _out_item_size;
+	}
+
+	int RNNEnsemble::member_count() const
+	{
+		return static_cast<int>(_members.size());
+	}
+}
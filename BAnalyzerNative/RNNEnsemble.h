@@ -0,0 +1,92 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+#include "RNN.h"
+#include <vector>
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// A set of nets (e.g., variants of different depths and layer sizes) evaluated at the same input in one call.
+	/// All the members must have the same input and output item sizes; each member is evaluated at the latest
+	/// time-points of the input (as many as its depth), and the outputs corresponding to the latest time-point
+	/// are combined into a weighted average. Members are evaluated in parallel on the shared thread pool.
+	/// An instance must not be used by several threads simultaneously.
+	/// </summary>
+	class RNNEnsemble
+	{
+		/// <summary>
+		/// Members of the same depth (they share the converted input).
+		/// </summary>
+		struct DepthGroup
+		{
+			int depth{};
+			std::vector<int> member_ids{};
+			DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t> input{};
+		};
+
+		std::vector<const RNN*> _members{};
+		std::vector<double> _weights{};
+		std::vector<DepthGroup> _groups{};
+		std::vector<DeepLearning::InOutMData<DeepLearning::CpuDC>> _caches{};
+		std::vector<double> _member_outputs{};
+		int _item_size{ -1 };
+		int _out_item_size{ -1 };
+		int _depth{ -1 };
+
+	public:
+
+		/// <summary>
+		/// Constructor.
+		/// </summary>
+		/// <param name="member_count">Number of items in <paramref name="members"/>.</param>
+		/// <param name="members">The nets to evaluate. Must outlive the ensemble.</param>
+		/// <param name="weights">Non-negative weights of the members in the average ("null" means equal weights).</param>
+		RNNEnsemble(const int member_count, const RNN* const* members, const double* weights);
+
+		/// <summary>
+		/// Evaluates all the members at the given <paramref name="input"/> consisting of "depth" time-point items
+		/// (see "depth") and writes the weighted average of the outputs of the members corresponding to the latest
+		/// time-point into <paramref name="output"/>; optionally (if <paramref name="member_outputs"/> is not "null")
+		/// writes the outputs of the members themselves (one after another). Returns number of elements written
+		/// into <paramref name="output"/>.
+		/// </summary>
+		int evaluate(const int size, const double* input, const int output_capacity, double* output,
+			const int member_output_capacity, double* member_outputs);
+
+		/// <summary>
+		/// Returns number of time-point items the input must consist of (the maximal depth of the members).
+		/// </summary>
+		int depth() const;
+
+		/// <summary>
+		/// Returns size of a time-point item of the input.
+		/// </summary>
+		int input_item_size() const;
+
+		/// <summary>
+		/// Returns size of an output item of the members.
+		/// </summary>
+		int output_item_size() const;
+
+		/// <summary>
+		/// Returns number of members.
+		/// </summary>
+		int member_count() const;
+	};
+}
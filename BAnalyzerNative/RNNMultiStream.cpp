@@ -0,0 +1,98 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "RNNMultiStream.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <numeric>
+
+namespace BAnalyzerNative
+{
+	RNNMultiStream::RNNMultiStream(const RNN& net, const int stream_count)
+	{
+		if (stream_count < 1)
+			throw std::exception("Invalid number of streams.");
+
+		_item_size = static_cast<int>(net.in_size().xyz.coord_prod());
+		_out_item_size = static_cast<int>(net.out_size().xyz.coord_prod());
+		_streams.reserve(stream_count);
+
+		for (auto stream_id = 0; stream_id < stream_count; ++stream_id)
+			_streams.emplace_back(net);
+
+		_outputs.resize(static_cast<std::size_t>(stream_count) * _out_item_size);
+	}
+
+	int RNNMultiStream::push_all(const int aggregate_size, const double* items)
+	{
+		const auto stream_count = static_cast<int>(_streams.size());
+
+		if (aggregate_size != stream_count * _item_size || !items)
+			throw std::exception("Invalid input data.");
+
+		// Streams are split into contiguous shards (one per worker) to keep the per-task overhead low.
+		auto& pool = ThreadPool::shared();
+		const auto shard_count = std::min(pool.thread_count(), stream_count);
+		std::vector<int> ready_counts(shard_count);
+
+		pool.parallel_for(shard_count, [&](const int shard_id)
+			{
+				const auto begin_stream_id = stream_count * shard_id / shard_count;
+				const auto end_stream_id = stream_count * (shard_id + 1) / shard_count;
+
+				for (auto stream_id = begin_stream_id; stream_id < end_stream_id; ++stream_id)
+				{
+					const auto written_count = _streams[stream_id].push(_item_size,
+						items + static_cast<std::size_t>(stream_id) * _item_size, _out_item_size,
+						_outputs.data() + static_cast<std::size_t>(stream_id) * _out_item_size);
+
+					ready_counts[shard_id] += written_count > 0 ? 1 : 0;
+				}
+			});
+
+		const auto ready_count = std::accumulate(ready_counts.begin(), ready_counts.end(), 0);
+		_outputs_ready = ready_count == stream_count;
+
+		return ready_count;
+	}
+
+	int RNNMultiStream::read_all(const int output_capacity, double* output) const
+	{
+		if (!_outputs_ready)
+			return 0;
+
+		if (output_capacity < static_cast<int>(_outputs.size()) || !output)
+			throw std::exception("Insufficient output capacity.");
+
+		std::ranges::copy(_outputs, output);
+
+		return static_cast<int>(_outputs.size());
+	}
+
+	void RNNMultiStream::reset()
+	{
+		for (auto& stream : _streams)
+			stream.reset();
+
+		_outputs_ready = false;
+	}
+
+	int RNNMultiStream::stream_count() const
+	{
+		return static_cast<int>(_streams.size());
+	}
+}
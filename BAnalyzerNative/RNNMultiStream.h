@@ -0,0 +1,76 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+#include "RNNStream.h"
+#include <vector>
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// A set of "K" independent evaluation streams (see "RNNStream") of the same RNN advanced in lockstep,
+	/// e.g., one stream per trading symbol. Each "push_all" call appends one time-point item to every stream;
+	/// the streams are evaluated in parallel on the shared thread pool. Stacking the states of the streams into
+	/// a single matrix-matrix step of each layer requires a single-step entry point of the layers of the net.
+	/// </summary>
+	class RNNMultiStream
+	{
+		std::vector<RNNStream> _streams{};
+		std::vector<double> _outputs{};
+		int _item_size{ -1 };
+		int _out_item_size{ -1 };
+		bool _outputs_ready{};
+
+	public:
+
+		/// <summary>
+		/// Constructor.
+		/// </summary>
+		/// <param name="net">The net to evaluate. Must outlive the multi-stream.</param>
+		/// <param name="stream_count">Number of streams.</param>
+		RNNMultiStream(const RNN& net, const int stream_count);
+
+		/// <summary>
+		/// Appends a time-point item to each of the streams.
+		/// Returns number of streams whose windows are complete (i.e., "0" during the first "depth - 1" calls
+		/// and the number of streams afterward); outputs of those can be read with "read_all".
+		/// </summary>
+		/// <param name="aggregate_size">Number of elements in <paramref name="items"/>, must be
+		/// equal to the number of streams times the input item size of the net.</param>
+		/// <param name="items">Time-point items of all the streams (one after another).</param>
+		int push_all(const int aggregate_size, const double* items);
+
+		/// <summary>
+		/// Writes outputs of the net corresponding to the latest time-point of each stream (one after another)
+		/// into the given <paramref name="output"/> buffer. Returns number of the written elements
+		/// (which is "0" if the windows of the streams are not complete yet).
+		/// </summary>
+		/// <param name="output_capacity">Number of elements that can be written to <paramref name="output"/>.</param>
+		/// <param name="output">Buffer to store the result.</param>
+		int read_all(const int output_capacity, double* output) const;
+
+		/// <summary>
+		/// Discards all the items pushed into all the streams.
+		/// </summary>
+		void reset();
+
+		/// <summary>
+		/// Returns number of streams.
+		/// </summary>
+		int stream_count() const;
+	};
+}
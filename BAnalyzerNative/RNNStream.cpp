@@ -0,0 +1,67 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "RNNStream.h"
+#include "DataConversionUtils.h"
+
+using namespace DeepLearning;
+
+namespace BAnalyzerNative
+{
+	RNNStream::RNNStream(const RNN& net) : _net(net)
+	{
+		_window.resize(_net.in_size().w);
+		_item_size = static_cast<int>(_net.in_size().xyz.coord_prod());
+	}
+
+	int RNNStream::push(const int item_size, const double* item, const int output_capacity, double* output)
+	{
+		if (item_size != _item_size)
+			throw std::exception("Invalid input data.");
+
+		// Rotate the window by one position so that the oldest item ends up
+		// at the back (tensors are swapped, not copied) and gets overwritten.
+		for (auto item_id = 1ull; item_id < _window.size(); ++item_id)
+			std::swap(_window[item_id - 1], _window[item_id]);
+
+		DataConversionUtils::fill_tensor(item_size, item, _window[_window.size() - 1]);
+
+		if (++_pushed_count < static_cast<int>(_window.size()))
+			return 0;
+
+		const auto out_item_size = static_cast<int>(_net.out_size().xyz.coord_prod());
+
+		if (output_capacity < out_item_size || !output)
+			throw std::exception("Insufficient output capacity.");
+
+		_net.evaluate(_window, _cache);
+		const auto& out = _cache.out();
+		DataConversionUtils::pack_tensor(out[out.size() - 1], output);
+
+		return out_item_size;
+	}
+
+	void RNNStream::reset()
+	{
+		_pushed_count = 0;
+	}
+
+	int RNNStream::pushed_count() const
+	{
+		return _pushed_count;
+	}
+}
@@ -0,0 +1,68 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+#include "RNN.h"
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// Stateful "stream" evaluator of an RNN to be used for "live" inference.
+	/// Keeps the latest (already converted) input window of the net natively,
+	/// so that each new time-point item is marshalled and converted only once.
+	/// Each push evaluates the net on the whole window; keeping the hidden state of the layers between the pushes
+	/// requires a single-step entry point of the layers of the net.
+	/// </summary>
+	class RNNStream
+	{
+		const RNN& _net;
+		DeepLearning::LazyVector<DeepLearning::CpuDC::tensor_t> _window{};
+		DeepLearning::InOutMData<DeepLearning::CpuDC> _cache{};
+		int _item_size{ -1 };
+		int _pushed_count{};
+
+	public:
+
+		/// <summary>
+		/// Constructor.
+		/// </summary>
+		/// <param name="net">The net to evaluate. Must outlive the stream.</param>
+		RNNStream(const RNN& net);
+
+		/// <summary>
+		/// Appends the given time-point <paramref name="item"/> to the stream (the oldest time-point item falls out
+		/// of the window) and, if the window is complete, writes output of the net that corresponds to the latest
+		/// time-point into the given <paramref name="output"/> buffer.
+		/// Returns number of elements written into the buffer (which is "0" until the first "depth" items are pushed).
+		/// </summary>
+		/// <param name="item_size">Number of elements in <paramref name="item"/>.</param>
+		/// <param name="item">Input time-point item.</param>
+		/// <param name="output_capacity">Number of elements that can be written to <paramref name="output"/>.</param>
+		/// <param name="output">Buffer to store the result.</param>
+		int push(const int item_size, const double* item, const int output_capacity, double* output);
+
+		/// <summary>
+		/// Discards all the pushed items.
+		/// </summary>
+		void reset();
+
+		/// <summary>
+		/// Returns number of items pushed into the stream since construction or the latest reset.
+		/// </summary>
+		int pushed_count() const;
+	};
+}
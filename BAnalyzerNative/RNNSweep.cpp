@@ -0,0 +1,109 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include "RNNSweep.h"
+#include "RNN.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <numeric>
+#include <thread>
+
+namespace BAnalyzerNative
+{
+	namespace
+	{
+		/// <summary>
+		/// Returns an estimate of the amount of work needed to train the net of the given <paramref name="candidate"/>
+		/// on a window (proportional to the number of multiplications in the forward pass).
+		/// </summary>
+		double estimate_work(const SweepCandidate& candidate)
+		{
+			auto result = 0.0;
+
+			for (auto layer_id = 1ull; layer_id < candidate.layer_item_sizes.size(); ++layer_id)
+			{
+				const auto in_size = static_cast<double>(candidate.layer_item_sizes[layer_id - 1]);
+				const auto out_size = static_cast<double>(candidate.layer_item_sizes[layer_id]);
+				// Input and recurrent weights.
+				result += out_size * (in_size + out_size);
+			}
+
+			return result * candidate.time_depth;
+		}
+	}
+
+	std::vector<SweepResult> RNNSweep::run(const std::vector<SweepCandidate>& candidates, const RnnCost cost,
+		const int series_size, const double* input_series, const int ref_series_size, const double* reference_series,
+		const int stride, const FitOptions& options, const int thread_count, std::vector<std::unique_ptr<RNN>>& nets)
+	{
+		if (candidates.empty() || !input_series || !reference_series || thread_count < 0 ||
+			options.validation_fraction <= 0)
+			throw std::exception("Invalid sweep parameters.");
+
+		const auto candidate_count = static_cast<int>(candidates.size());
+		nets.clear();
+		nets.reserve(candidate_count);
+
+		// All the nets are constructed beforehand, so that an invalid candidate fails the sweep before any training.
+		for (const auto& candidate : candidates)
+		{
+			if (!candidate.activations.empty() && candidate.activations.size() + 1 != candidate.layer_item_sizes.size())
+				throw std::exception("Invalid sweep parameters.");
+
+			nets.push_back(std::make_unique<RNN>(candidate.time_depth, static_cast<int>(candidate.layer_item_sizes.size()),
+				candidate.layer_item_sizes.data(), candidate.activations.empty() ? nullptr : candidate.activations.data(), cost));
+		}
+
+		// The most expensive candidates go first, so that the threads do not end up waiting for a single long training.
+		std::vector<int> order(candidate_count);
+		std::iota(order.begin(), order.end(), 0);
+		std::ranges::stable_sort(order, [&](const int a, const int b)
+			{
+				return estimate_work(candidates[a]) > estimate_work(candidates[b]);
+			});
+
+		std::vector<SweepResult> result(candidate_count);
+		const auto train = [&](const int order_id)
+			{
+				const auto candidate_id = order[order_id];
+				result[candidate_id].candidate_id = candidate_id;
+				result[candidate_id].fit = nets[candidate_id]->fit_series(series_size, input_series,
+					ref_series_size, reference_series, stride, options);
+			};
+
+		const auto concurrency = std::min(candidate_count, thread_count > 0 ? thread_count :
+			std::max(static_cast<int>(std::thread::hardware_concurrency()), 1));
+
+		if (concurrency == 1)
+		{
+			for (auto order_id = 0; order_id < candidate_count; ++order_id)
+				train(order_id);
+		} else
+		{
+			// A dedicated pool (the calling thread being one of the participants) keeps the workers of
+			// the shared pool available for the data conversion done by each training in the background.
+			ThreadPool pool(concurrency - 1);
+			pool.parallel_for(candidate_count, train);
+		}
+
+		std::ranges::stable_sort(result, [](const SweepResult& a, const SweepResult& b)
+			{
+				return a.fit.best_validation_cost < b.fit.best_validation_cost;
+			});
+
+		return result;
+	}
+}
@@ -0,0 +1,84 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#pragma once
+#include "FitOptions.h"
+#include "RnnFunctions.h"
+#include <memory>
+#include <vector>
+
+namespace BAnalyzerNative
+{
+	class RNN;
+
+	/// <summary>
+	/// Configuration of a candidate net of a hyperparameter sweep (see "RNNSweep").
+	/// </summary>
+	struct SweepCandidate
+	{
+		/// <summary>
+		/// Recurrence depth of the net.
+		/// </summary>
+		int time_depth{};
+
+		/// <summary>
+		/// Item sizes of all the layers including the input one.
+		/// </summary>
+		std::vector<int> layer_item_sizes{};
+
+		/// <summary>
+		/// Activation functions of the layers (one less than the number of item sizes) or empty if all the layers use sigmoid.
+		/// </summary>
+		std::vector<RnnActivation> activations{};
+	};
+
+	/// <summary>
+	/// Outcome of the training of a candidate of a hyperparameter sweep.
+	/// The layout is shared with the managed side, so the structure must stay "plain".
+	/// </summary>
+	struct SweepResult
+	{
+		/// <summary>
+		/// Summary of the training of the candidate.
+		/// </summary>
+		FitResult fit{};
+
+		/// <summary>
+		/// Zero-based index of the candidate in the grid.
+		/// </summary>
+		int candidate_id{};
+	};
+
+	/// <summary>
+	/// Hyperparameter sweep: trains a grid of candidate nets concurrently on the same (shared, read-only) time series
+	/// and ranks them by their cost on the held-out part of the series.
+	/// </summary>
+	struct RNNSweep
+	{
+		/// <summary>
+		/// Constructs the nets of the given <paramref name="candidates"/> (all trained with the given <paramref name="cost"/>
+		/// function), trains each of them on the windows of the given series (see RNN::fit_series) according to the given
+		/// <paramref name="options"/> (whose validation fraction must be positive) and returns the results ordered by the
+		/// best validation cost (the lowest first). The candidates are trained on <paramref name="thread_count"/> threads
+		/// ("0" means the number of hardware threads), each thread taking the next untrained candidate as soon as it
+		/// is done with the previous one; the series are read directly from the given arrays by all the threads.
+		/// The trained nets are put into <paramref name="nets"/> in the order of the candidates.
+		/// </summary>
+		static std::vector<SweepResult> run(const std::vector<SweepCandidate>& candidates, const RnnCost cost,
+			const int series_size, const double* input_series, const int ref_series_size, const double* reference_series,
+			const int stride, const FitOptions& options, const int thread_count, std::vector<std::unique_ptr<RNN>>& nets);
+	};
+}
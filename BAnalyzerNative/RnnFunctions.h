@@ -0,0 +1,43 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// Identifiers of the activation functions that can be assigned to the layers of an RNN
+	/// (values are part of the interface of the DLL and must not be changed).
+	/// </summary>
+	enum class RnnActivation : int
+	{
+		Sigmoid = 0,
+		Tanh = 1,
+		Relu = 2,
+		Linear = 3,
+	};
+
+	/// <summary>
+	/// Identifiers of the cost functions an RNN can be trained with
+	/// (values are part of the interface of the DLL and the format of saved nets and must not be changed).
+	/// </summary>
+	enum class RnnCost : int
+	{
+		CrossEntropy = 0,
+		SquaredError = 1,
+	};
+}
@@ -0,0 +1,150 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "SeriesAnomalyDetector.h"
+#include <algorithm>
+#include <cmath>
+#include <exception>
+
+namespace BAnalyzerNative
+{
+	namespace
+	{
+		/// <summary>
+		/// Parameter of the power martingale.
+		/// </summary>
+		constexpr double MartingaleEpsilon = 0.1;
+
+		/// <summary>
+		/// Lower bound of the p-values used in the martingale updates (prevents infinite updates).
+		/// </summary>
+		constexpr double MinPValue = 1e-8;
+	}
+
+	SeriesAnomalyDetector::SeriesAnomalyDetector(const AnomalyKind kind, const int history_length,
+		const double confidence) : _kind(kind), _history_length(history_length)
+	{
+		if (kind != AnomalyKind::Spike && kind != AnomalyKind::ChangePoint)
+			throw std::exception("Unsupported kind of anomalies.");
+
+		if (history_length < 2 || confidence <= 0 || confidence >= 100)
+			throw std::exception("Invalid parameters of the anomaly detector.");
+
+		_alert_threshold = 1.0 - confidence / 100.0;
+		_history.resize(history_length);
+	}
+
+	double SeriesAnomalyDetector::calc_p_value(const double value) const
+	{
+		auto mean = 0.0;
+		for (auto item_id = 0; item_id < _history_count; ++item_id)
+			mean += _history[item_id];
+
+		mean /= _history_count;
+
+		auto variance = 0.0;
+		for (auto item_id = 0; item_id < _history_count; ++item_id)
+			variance += (_history[item_id] - mean) * (_history[item_id] - mean);
+
+		variance /= std::max(_history_count - 1, 1);
+
+		// Silverman's rule of thumb for the bandwidth; the lower bound
+		// keeps the estimate well-defined for a constant history.
+		const auto min_bandwidth = 1e-8 * std::max(1.0, std::abs(mean));
+		const auto bandwidth = std::max(1.06 * std::sqrt(variance) * std::pow(_history_count, -0.2), min_bandwidth);
+
+		auto cdf = 0.0;
+		for (auto item_id = 0; item_id < _history_count; ++item_id)
+			cdf += 0.5 * std::erfc(-(value - _history[item_id]) / (bandwidth * std::sqrt(2.0)));
+
+		cdf /= _history_count;
+
+		return 2 * std::min(cdf, 1.0 - cdf);
+	}
+
+	void SeriesAnomalyDetector::add_to_history(const double value)
+	{
+		if (_history_count < _history_length)
+			_history[(_history_begin + _history_count++) % _history_length] = value;
+		else
+		{
+			_history[_history_begin] = value;
+			_history_begin = (_history_begin + 1) % _history_length;
+		}
+	}
+
+	bool SeriesAnomalyDetector::push(const double value)
+	{
+		// The density estimate is not reliable until the history is complete.
+		if (_history_count < _history_length)
+		{
+			add_to_history(value);
+			return false;
+		}
+
+		const auto p_value = calc_p_value(value);
+
+		if (_kind == AnomalyKind::Spike)
+		{
+			add_to_history(value);
+			return p_value < _alert_threshold;
+		}
+
+		_log_martingale = std::max(0.0, _log_martingale + std::log(MartingaleEpsilon) +
+			(MartingaleEpsilon - 1.0) * std::log(std::max(p_value, MinPValue)));
+
+		if (_log_martingale <= -std::log(_alert_threshold))
+		{
+			add_to_history(value);
+			return false;
+		}
+
+		// The distribution has changed, so the values before the change point are no longer representative.
+		reset();
+		add_to_history(value);
+
+		return true;
+	}
+
+	int SeriesAnomalyDetector::push(const int count, const double* values, const int capacity, int* anomaly_ids)
+	{
+		if (count < 0 || (count > 0 && !values) || (capacity > 0 && !anomaly_ids))
+			throw std::exception("Invalid input data.");
+
+		// Any of the values can be an anomaly, so the capacity is validated before
+		// the state of the detector is touched.
+		if (capacity < count)
+			throw std::exception("Insufficient output capacity.");
+
+		auto anomaly_count = 0;
+
+		for (auto value_id = 0; value_id < count; ++value_id)
+		{
+			if (push(values[value_id]))
+				anomaly_ids[anomaly_count++] = value_id;
+		}
+
+		return anomaly_count;
+	}
+
+	void SeriesAnomalyDetector::reset()
+	{
+		_history_begin = 0;
+		_history_count = 0;
+		_log_martingale = 0;
+	}
+}
@@ -0,0 +1,98 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+#include <vector>
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// Kinds of the anomalies a "SeriesAnomalyDetector" can detect (values are part of the interface of the DLL).
+	/// </summary>
+	enum class AnomalyKind : int
+	{
+		Spike = 0,
+		ChangePoint = 1,
+	};
+
+	/// <summary>
+	/// Streaming detector of anomalies in a series of values treated as independent identically distributed ones.
+	/// The p-value of each new value is estimated with a Gaussian kernel density built on the last "history_length"
+	/// values; a spike is a value with a two-sided p-value below "1 - confidence". A change point is detected when
+	/// the power martingale of the p-values (reflected at "1", so that it does not drift to zero while the series
+	/// is stable) exceeds "1 / (1 - confidence)"; after that the history is discarded.
+	/// No anomalies are reported until the history is complete.
+	/// Each new value costs O(history_length) operations.
+	/// </summary>
+	class SeriesAnomalyDetector
+	{
+		AnomalyKind _kind{};
+		int _history_length{};
+		double _alert_threshold{};
+
+		/// <summary>
+		/// The last values of the series (ring buffer).
+		/// </summary>
+		std::vector<double> _history{};
+
+		int _history_begin{};
+		int _history_count{};
+
+		/// <summary>
+		/// Logarithm of the martingale (non-negative).
+		/// </summary>
+		double _log_martingale{};
+
+		/// <summary>
+		/// Returns two-sided p-value of the given <paramref name="value"/> with respect to the history.
+		/// </summary>
+		double calc_p_value(const double value) const;
+
+		/// <summary>
+		/// Appends the given value to the history.
+		/// </summary>
+		void add_to_history(const double value);
+
+	public:
+
+		/// <summary>
+		/// Constructor.
+		/// </summary>
+		/// <param name="kind">Kind of the anomalies to detect.</param>
+		/// <param name="history_length">Number of the last values the p-values are calculated on.</param>
+		/// <param name="confidence">Confidence (in percents, in (0, 100)) required to report an anomaly.</param>
+		SeriesAnomalyDetector(const AnomalyKind kind, const int history_length, const double confidence);
+
+		/// <summary>
+		/// Processes the next value of the series; returns "true" if the value is an anomaly.
+		/// </summary>
+		bool push(const double value);
+
+		/// <summary>
+		/// Processes the given <paramref name="count"/> next values of the series and writes zero-based indices
+		/// (within <paramref name="values"/>) of the anomalous ones into <paramref name="anomaly_ids"/>.
+		/// Returns number of the written indices. Throws exception (leaving the detector intact)
+		/// if <paramref name="capacity"/> of the output buffer is less than <paramref name="count"/>.
+		/// </summary>
+		int push(const int count, const double* values, const int capacity, int* anomaly_ids);
+
+		/// <summary>
+		/// Discards the history of the series.
+		/// </summary>
+		void reset();
+	};
+}
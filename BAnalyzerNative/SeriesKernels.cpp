@@ -0,0 +1,231 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "SeriesKernels.h"
+#include "SimdLevel.h"
+#include <algorithm>
+#include <cmath>
+#include <immintrin.h>
+
+namespace BAnalyzerNative
+{
+	namespace
+	{
+		// The vector kernels implement "std::max(a, b)" (which is "a < b ? b : a") as "max_pd(b, a)" (which is
+		// "b > a ? b : a"); the swapped order of the arguments would give other results for signed zeros and NaNs.
+
+		void gain_loss_scalar(const double* prev, const double* next, const long long size, double* gain, double* loss)
+		{
+			for (auto i = 0ll; i < size; ++i)
+			{
+				gain[i] = std::max(next[i] - prev[i], 0.0);
+				loss[i] = std::max(prev[i] - next[i], 0.0);
+			}
+		}
+
+		void gain_loss_sse2(const double* prev, const double* next, const long long size, double* gain, double* loss)
+		{
+			const auto zero = _mm_setzero_pd();
+			const auto vector_size = size & ~1ll;
+			for (auto i = 0ll; i < vector_size; i += 2)
+			{
+				const auto prev_values = _mm_loadu_pd(prev + i);
+				const auto next_values = _mm_loadu_pd(next + i);
+				_mm_storeu_pd(gain + i, _mm_max_pd(zero, _mm_sub_pd(next_values, prev_values)));
+				_mm_storeu_pd(loss + i, _mm_max_pd(zero, _mm_sub_pd(prev_values, next_values)));
+			}
+
+			gain_loss_scalar(prev + vector_size, next + vector_size, size - vector_size, gain + vector_size, loss + vector_size);
+		}
+
+		void gain_loss_avx2(const double* prev, const double* next, const long long size, double* gain, double* loss)
+		{
+			const auto zero = _mm256_setzero_pd();
+			const auto vector_size = size & ~3ll;
+			for (auto i = 0ll; i < vector_size; i += 4)
+			{
+				const auto prev_values = _mm256_loadu_pd(prev + i);
+				const auto next_values = _mm256_loadu_pd(next + i);
+				_mm256_storeu_pd(gain + i, _mm256_max_pd(zero, _mm256_sub_pd(next_values, prev_values)));
+				_mm256_storeu_pd(loss + i, _mm256_max_pd(zero, _mm256_sub_pd(prev_values, next_values)));
+			}
+
+			gain_loss_sse2(prev + vector_size, next + vector_size, size - vector_size, gain + vector_size, loss + vector_size);
+		}
+
+		void true_range_scalar(const double* high, const double* low, const double* prev_close,
+			const long long size, double* dest)
+		{
+			for (auto i = 0ll; i < size; ++i)
+				dest[i] = std::max({ high[i] - low[i], std::abs(high[i] - prev_close[i]), std::abs(low[i] - prev_close[i]) });
+		}
+
+		void true_range_sse2(const double* high, const double* low, const double* prev_close,
+			const long long size, double* dest)
+		{
+			const auto abs_mask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFF));
+			const auto vector_size = size & ~1ll;
+			for (auto i = 0ll; i < vector_size; i += 2)
+			{
+				const auto high_values = _mm_loadu_pd(high + i);
+				const auto low_values = _mm_loadu_pd(low + i);
+				const auto prev_close_values = _mm_loadu_pd(prev_close + i);
+				const auto range = _mm_sub_pd(high_values, low_values);
+				const auto high_gap = _mm_and_pd(_mm_sub_pd(high_values, prev_close_values), abs_mask);
+				const auto low_gap = _mm_and_pd(_mm_sub_pd(low_values, prev_close_values), abs_mask);
+				_mm_storeu_pd(dest + i, _mm_max_pd(low_gap, _mm_max_pd(high_gap, range)));
+			}
+
+			true_range_scalar(high + vector_size, low + vector_size, prev_close + vector_size,
+				size - vector_size, dest + vector_size);
+		}
+
+		void true_range_avx2(const double* high, const double* low, const double* prev_close,
+			const long long size, double* dest)
+		{
+			const auto abs_mask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFF));
+			const auto vector_size = size & ~3ll;
+			for (auto i = 0ll; i < vector_size; i += 4)
+			{
+				const auto high_values = _mm256_loadu_pd(high + i);
+				const auto low_values = _mm256_loadu_pd(low + i);
+				const auto prev_close_values = _mm256_loadu_pd(prev_close + i);
+				const auto range = _mm256_sub_pd(high_values, low_values);
+				const auto high_gap = _mm256_and_pd(_mm256_sub_pd(high_values, prev_close_values), abs_mask);
+				const auto low_gap = _mm256_and_pd(_mm256_sub_pd(low_values, prev_close_values), abs_mask);
+				_mm256_storeu_pd(dest + i, _mm256_max_pd(low_gap, _mm256_max_pd(high_gap, range)));
+			}
+
+			true_range_sse2(high + vector_size, low + vector_size, prev_close + vector_size,
+				size - vector_size, dest + vector_size);
+		}
+
+		void typical_price_scalar(const double* high, const double* low, const double* close,
+			const long long size, double* dest)
+		{
+			for (auto i = 0ll; i < size; ++i)
+				dest[i] = (high[i] + low[i] + close[i]) / 3.0;
+		}
+
+		void typical_price_sse2(const double* high, const double* low, const double* close,
+			const long long size, double* dest)
+		{
+			const auto three = _mm_set1_pd(3.0);
+			const auto vector_size = size & ~1ll;
+			for (auto i = 0ll; i < vector_size; i += 2)
+			{
+				const auto sum = _mm_add_pd(_mm_add_pd(_mm_loadu_pd(high + i), _mm_loadu_pd(low + i)), _mm_loadu_pd(close + i));
+				_mm_storeu_pd(dest + i, _mm_div_pd(sum, three));
+			}
+
+			typical_price_scalar(high + vector_size, low + vector_size, close + vector_size,
+				size - vector_size, dest + vector_size);
+		}
+
+		void typical_price_avx2(const double* high, const double* low, const double* close,
+			const long long size, double* dest)
+		{
+			const auto three = _mm256_set1_pd(3.0);
+			const auto vector_size = size & ~3ll;
+			for (auto i = 0ll; i < vector_size; i += 4)
+			{
+				const auto sum = _mm256_add_pd(_mm256_add_pd(_mm256_loadu_pd(high + i), _mm256_loadu_pd(low + i)),
+					_mm256_loadu_pd(close + i));
+				_mm256_storeu_pd(dest + i, _mm256_div_pd(sum, three));
+			}
+
+			typical_price_sse2(high + vector_size, low + vector_size, close + vector_size,
+				size - vector_size, dest + vector_size);
+		}
+
+		template <bool RoundUp>
+		void round_to_grid_scalar(const double* src, const long long size, const double scale, const double offset,
+			const double step, double* dest)
+		{
+			for (auto i = 0ll; i < size; ++i)
+			{
+				const auto value = src[i] * scale + offset;
+				dest[i] = (RoundUp ? std::ceil(value) : std::floor(value)) * step;
+			}
+		}
+
+		template <bool RoundUp>
+		void round_to_grid_avx2(const double* src, const long long size, const double scale, const double offset,
+			const double step, double* dest)
+		{
+			constexpr auto rounding = (RoundUp ? _MM_FROUND_TO_POS_INF : _MM_FROUND_TO_NEG_INF) | _MM_FROUND_NO_EXC;
+			const auto scale_vector = _mm256_set1_pd(scale);
+			const auto offset_vector = _mm256_set1_pd(offset);
+			const auto step_vector = _mm256_set1_pd(step);
+			const auto vector_size = size & ~3ll;
+			for (auto i = 0ll; i < vector_size; i += 4)
+			{
+				const auto values = _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(src + i), scale_vector), offset_vector);
+				_mm256_storeu_pd(dest + i, _mm256_mul_pd(_mm256_round_pd(values, rounding), step_vector));
+			}
+
+			round_to_grid_scalar<RoundUp>(src + vector_size, size - vector_size, scale, offset, step, dest + vector_size);
+		}
+
+		/// <summary>
+		/// Returns "true" if the AVX2 kernels can be used (AVX-512 capable CPUs run the AVX2 ones).
+		/// </summary>
+		bool use_avx2()
+		{
+			return simd_level() != SimdLevel::SSE2;
+		}
+	}
+
+	void SeriesKernels::gain_loss(const double* prev, const double* next, const long long size, double* gain, double* loss)
+	{
+		if (use_avx2())
+			gain_loss_avx2(prev, next, size, gain, loss);
+		else
+			gain_loss_sse2(prev, next, size, gain, loss);
+	}
+
+	void SeriesKernels::true_range(const double* high, const double* low, const double* prev_close,
+		const long long size, double* dest)
+	{
+		if (use_avx2())
+			true_range_avx2(high, low, prev_close, size, dest);
+		else
+			true_range_sse2(high, low, prev_close, size, dest);
+	}
+
+	void SeriesKernels::typical_price(const double* high, const double* low, const double* close,
+		const long long size, double* dest)
+	{
+		if (use_avx2())
+			typical_price_avx2(high, low, close, size, dest);
+		else
+			typical_price_sse2(high, low, close, size, dest);
+	}
+
+	void SeriesKernels::round_to_grid(const double* src, const long long size, const double scale, const double offset,
+		const double step, const bool round_up, double* dest)
+	{
+		if (use_avx2() && round_up)
+			round_to_grid_avx2<true>(src, size, scale, offset, step, dest);
+		else if (use_avx2())
+			round_to_grid_avx2<false>(src, size, scale, offset, step, dest);
+		else if (round_up)
+			round_to_grid_scalar<true>(src, size, scale, offset, step, dest);
+		else
+			round_to_grid_scalar<false>(src, size, scale, offset, step, dest);
+	}
+}
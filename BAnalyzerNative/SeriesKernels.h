@@ -0,0 +1,56 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// Element-wise kernels over price series. Each kernel uses the widest SIMD instruction set (AVX2 or SSE2)
+	/// available at run-time and yields exactly the same values as the scalar expression it is documented with.
+	/// </summary>
+	struct SeriesKernels
+	{
+		/// <summary>
+		/// Writes "max(next[i] - prev[i], 0)" into <paramref name="gain"/> and "max(prev[i] - next[i], 0)"
+		/// into <paramref name="loss"/> for each of the <paramref name="size"/> elements.
+		/// </summary>
+		static void gain_loss(const double* prev, const double* next, const long long size, double* gain, double* loss);
+
+		/// <summary>
+		/// Writes true range "max(high[i] - low[i], |high[i] - prev_close[i]|, |low[i] - prev_close[i]|)"
+		/// into <paramref name="dest"/> for each of the <paramref name="size"/> elements.
+		/// </summary>
+		static void true_range(const double* high, const double* low, const double* prev_close,
+			const long long size, double* dest);
+
+		/// <summary>
+		/// Writes typical price "(high[i] + low[i] + close[i]) / 3" into <paramref name="dest"/>
+		/// for each of the <paramref name="size"/> elements.
+		/// </summary>
+		static void typical_price(const double* high, const double* low, const double* close,
+			const long long size, double* dest);
+
+		/// <summary>
+		/// Writes "floor(src[i] * scale + offset) * step" (or "ceil" instead of "floor" if <paramref name="round_up"/>
+		/// is "true") into <paramref name="dest"/> for each of the <paramref name="size"/> elements.
+		/// SSE2 has no rounding instructions, so the kernel is scalar on the CPUs without AVX2.
+		/// </summary>
+		static void round_to_grid(const double* src, const long long size, const double scale, const double offset,
+			const double step, const bool round_up, double* dest);
+	};
+}
@@ -0,0 +1,66 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "SimdLevel.h"
+#include <immintrin.h>
+#include <intrin.h>
+
+namespace BAnalyzerNative
+{
+	namespace
+	{
+		/// <summary>
+		/// Returns the widest instruction set supported by both the CPU and the OS.
+		/// </summary>
+		SimdLevel detect_simd_level()
+		{
+			int regs[4]{};
+			__cpuid(regs, 0);
+			const auto max_leaf = regs[0];
+
+			__cpuid(regs, 1);
+			const auto os_uses_xsave = (regs[2] & (1 << 27)) != 0;
+			const auto cpu_has_avx = (regs[2] & (1 << 28)) != 0;
+
+			if (max_leaf < 7 || !os_uses_xsave || !cpu_has_avx)
+				return SimdLevel::SSE2;
+
+			const auto xcr0 = _xgetbv(0);
+			// XMM and YMM states (and additionally "opmask" and ZMM states for AVX-512) must be enabled by the OS.
+			const auto os_supports_avx = (xcr0 & 0x06) == 0x06;
+			const auto os_supports_avx512 = (xcr0 & 0xE6) == 0xE6;
+
+			__cpuidex(regs, 7, 0);
+			const auto cpu_has_avx2 = (regs[1] & (1 << 5)) != 0;
+			const auto cpu_has_avx512f = (regs[1] & (1 << 16)) != 0;
+
+			if (cpu_has_avx512f && os_supports_avx512)
+				return SimdLevel::AVX512;
+
+			if (cpu_has_avx2 && os_supports_avx)
+				return SimdLevel::AVX2;
+
+			return SimdLevel::SSE2;
+		}
+	}
+
+	SimdLevel simd_level()
+	{
+		static const auto level = detect_simd_level();
+		return level;
+	}
+}
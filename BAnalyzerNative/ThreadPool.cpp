@@ -0,0 +1,155 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace BAnalyzerNative
+{
+	ThreadPool::ThreadPool(const int thread_count)
+	{
+		const auto actual_thread_count = thread_count > 0 ? thread_count :
+			std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+		_workers.reserve(actual_thread_count);
+
+		for (auto thread_id = 0; thread_id < actual_thread_count; ++thread_id)
+			_workers.emplace_back([this]() { worker_loop(); });
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard lock(_mutex);
+			_stop = true;
+		}
+
+		_task_available.notify_all();
+
+		for (auto& worker : _workers)
+			worker.join();
+	}
+
+	void ThreadPool::worker_loop()
+	{
+		while (true)
+		{
+			std::function<void()> task;
+
+			{
+				std::unique_lock lock(_mutex);
+				_task_available.wait(lock, [this]() { return _stop || !_tasks.empty(); });
+
+				if (_tasks.empty())
+					return;
+
+				task = std::move(_tasks.front());
+				_tasks.pop_front();
+			}
+
+			task();
+		}
+	}
+
+	void ThreadPool::submit(std::function<void()> task)
+	{
+		{
+			std::lock_guard lock(_mutex);
+			_tasks.push_back(std::move(task));
+		}
+
+		_task_available.notify_one();
+	}
+
+	namespace
+	{
+		/// <summary>
+		/// State shared by the participants of a "parallel for" call.
+		/// </summary>
+		struct ParallelForState
+		{
+			std::atomic<int> next_id{};
+			int completed_count{};
+			std::exception_ptr exception{};
+			std::mutex mutex{};
+			std::condition_variable completed{};
+
+			/// <summary>
+			/// Executes <paramref name="func"/> for the indices that have not been taken yet.
+			/// </summary>
+			void run(const int count, const std::function<void(const int)>& func)
+			{
+				for (auto id = next_id++; id < count; id = next_id++)
+				{
+					try
+					{
+						func(id);
+					} catch (...)
+					{
+						std::lock_guard lock(mutex);
+						if (!exception)
+							exception = std::current_exception();
+					}
+
+					std::lock_guard lock(mutex);
+					if (++completed_count == count)
+						completed.notify_all();
+				}
+			}
+		};
+	}
+
+	void ThreadPool::parallel_for(const int count, const std::function<void(const int)>& func)
+	{
+		if (count <= 0)
+			return;
+
+		const auto state = std::make_shared<ParallelForState>();
+		const auto helper_count = std::min(count, thread_count() + 1) - 1;
+
+		// Helpers capture the state by value, so that the ones that start after
+		// the call has returned find no work and do not touch a dangling state.
+		for (auto helper_id = 0; helper_id < helper_count; ++helper_id)
+			submit([state, count, &func]()
+			{
+				if (state->next_id < count)
+					state->run(count, func);
+			});
+
+		state->run(count, func);
+
+		std::unique_lock lock(state->mutex);
+		state->completed.wait(lock, [&]() { return state->completed_count == count; });
+
+		if (state->exception)
+			std::rethrow_exception(state->exception);
+	}
+
+	int ThreadPool::thread_count() const
+	{
+		return static_cast<int>(_workers.size());
+	}
+
+	ThreadPool& ThreadPool::shared()
+	{
+		static ThreadPool pool{};
+		return pool;
+	}
+}
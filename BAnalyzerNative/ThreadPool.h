@@ -0,0 +1,84 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace BAnalyzerNative
+{
+	/// <summary>
+	/// A simple pool of worker threads executing tasks from a common FIFO queue.
+	/// </summary>
+	class ThreadPool
+	{
+		std::vector<std::thread> _workers{};
+		std::deque<std::function<void()>> _tasks{};
+		std::mutex _mutex{};
+		std::condition_variable _task_available{};
+		bool _stop{};
+
+		/// <summary>
+		/// Main loop of a worker thread.
+		/// </summary>
+		void worker_loop();
+
+	public:
+
+		/// <summary>
+		/// Constructor.
+		/// </summary>
+		/// <param name="thread_count">Number of worker threads; if non-positive, the
+		/// number of hardware threads is used.</param>
+		explicit ThreadPool(const int thread_count = 0);
+
+		/// <summary>
+		/// Destructor. Waits until all the submitted tasks are completed.
+		/// </summary>
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		/// <summary>
+		/// Enqueues the given <paramref name="task"/> for execution on one of the worker threads.
+		/// </summary>
+		void submit(std::function<void()> task);
+
+		/// <summary>
+		/// Calls <paramref name="func"/> for each index in [0, <paramref name="count"/>) using the worker threads
+		/// and returns when all the calls are completed. The calling thread takes part in the execution, so
+		/// the method can be safely called from within a task running on the pool.
+		/// The first exception thrown by <paramref name="func"/> (if any) is re-thrown in the calling thread.
+		/// </summary>
+		void parallel_for(const int count, const std::function<void(const int)>& func);
+
+		/// <summary>
+		/// Returns number of worker threads.
+		/// </summary>
+		int thread_count() const;
+
+		/// <summary>
+		/// Returns an instance of the pool shared by the whole library (with a thread per hardware thread).
+		/// </summary>
+		static ThreadPool& shared();
+	};
+}
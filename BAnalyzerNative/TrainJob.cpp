@@ -0,0 +1,99 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "TrainJob.h"
+#include "RNN.h"
+#include "ThreadPool.h"
+#include <chrono>
+
+namespace BAnalyzerNative
+{
+	TrainJob::TrainJob(RNN& net, const int in_aggregate_size, const double* input_aggregate, const int ref_aggregate_size,
+		const double* reference_aggregate, const FitOptions& options, EpochCallback on_epoch)
+	{
+		if (in_aggregate_size <= 0 || ref_aggregate_size <= 0 || !input_aggregate || !reference_aggregate)
+			throw std::exception("Invalid training data.");
+
+		pool().submit([state = _state, stop_token = _stop_source.get_token(), &net,
+			input = std::vector(input_aggregate, input_aggregate + in_aggregate_size),
+			reference = std::vector(reference_aggregate, reference_aggregate + ref_aggregate_size),
+			options, on_epoch = std::move(on_epoch)]()
+			{
+				FitResult result{};
+				auto status = Status::Completed;
+
+				try
+				{
+					result = net.fit(static_cast<int>(input.size()), input.data(), static_cast<int>(reference.size()),
+						reference.data(), options, on_epoch, stop_token);
+
+					if (stop_token.stop_requested())
+						status = Status::Cancelled;
+				} catch (...)
+				{
+					status = Status::Failed;
+				}
+
+				std::lock_guard lock(state->mutex);
+				state->result = result;
+				state->status = status;
+				state->finished.notify_all();
+			});
+	}
+
+	TrainJob::~TrainJob()
+	{
+		cancel();
+		wait(-1);
+	}
+
+	void TrainJob::cancel()
+	{
+		_stop_source.request_stop();
+	}
+
+	TrainJob::Status TrainJob::wait(const int timeout_ms) const
+	{
+		std::unique_lock lock(_state->mutex);
+		const auto is_finished = [this]() { return _state->status != Status::Running; };
+
+		if (timeout_ms < 0)
+			_state->finished.wait(lock, is_finished);
+		else
+			_state->finished.wait_for(lock, std::chrono::milliseconds(timeout_ms), is_finished);
+
+		return _state->status;
+	}
+
+	TrainJob::Status TrainJob::status() const
+	{
+		std::lock_guard lock(_state->mutex);
+		return _state->status;
+	}
+
+	FitResult TrainJob::result() const
+	{
+		std::lock_guard lock(_state->mutex);
+		return _state->result;
+	}
+
+	ThreadPool& TrainJob::pool()
+	{
+		static ThreadPool pool{};
+		return pool;
+	}
+}
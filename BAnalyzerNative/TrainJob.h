@@ -0,0 +1,111 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+#include "FitOptions.h"
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <vector>
+
+namespace BAnalyzerNative
+{
+	class RNN;
+	class ThreadPool;
+
+	/// <summary>
+	/// A multi-epoch training (see RNN::fit) running on a worker thread of the pool of training jobs.
+	/// The job owns copies of the training data, so the caller's arrays can be released right after the job is
+	/// started; the net must stay alive until the job is finished (the destructor cancels the job and waits for it).
+	/// </summary>
+	class TrainJob
+	{
+	public:
+
+		/// <summary>
+		/// Status of a job (values are part of the interface of the DLL).
+		/// </summary>
+		enum class Status : int
+		{
+			Running = 0,
+			Completed = 1,
+			Cancelled = 2,
+			Failed = 3,
+		};
+
+	private:
+
+		/// <summary>
+		/// State shared by the job and the task executing it.
+		/// </summary>
+		struct State
+		{
+			std::mutex mutex{};
+			std::condition_variable finished{};
+			Status status{ Status::Running };
+			FitResult result{};
+		};
+
+		std::shared_ptr<State> _state{ std::make_shared<State>() };
+		std::stop_source _stop_source{};
+
+	public:
+
+		/// <summary>
+		/// Constructor. Starts training of the given <paramref name="net"/> (see RNN::fit for the description
+		/// of the parameters); <paramref name="on_epoch"/> is called on the worker thread.
+		/// </summary>
+		TrainJob(RNN& net, const int in_aggregate_size, const double* input_aggregate, const int ref_aggregate_size,
+			const double* reference_aggregate, const FitOptions& options, EpochCallback on_epoch);
+
+		/// <summary>
+		/// Destructor. Cancels the job and waits until it is finished.
+		/// </summary>
+		~TrainJob();
+
+		TrainJob(const TrainJob&) = delete;
+		TrainJob& operator=(const TrainJob&) = delete;
+
+		/// <summary>
+		/// Requests the job to stop; the training stops after the mini-batch that is in progress.
+		/// </summary>
+		void cancel();
+
+		/// <summary>
+		/// Waits until the job is finished or <paramref name="timeout_ms"/> milliseconds elapse
+		/// (negative value means "no timeout") and returns the status of the job.
+		/// </summary>
+		Status wait(const int timeout_ms) const;
+
+		/// <summary>
+		/// Returns the status of the job.
+		/// </summary>
+		Status status() const;
+
+		/// <summary>
+		/// Returns summary of the training (meaningful only when the job is finished).
+		/// </summary>
+		FitResult result() const;
+
+		/// <summary>
+		/// Returns the pool executing the training jobs. It is separate from the shared pool, so that
+		/// long jobs do not hold the workers used to parallelize evaluation and training of individual batches.
+		/// </summary>
+		static ThreadPool& pool();
+	};
+}
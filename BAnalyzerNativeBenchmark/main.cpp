@@ -0,0 +1,315 @@
+//Copyright (c) 2025 Denys Dragunov, dragunovdenis@gmail.com
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is furnished
+//to do so, subject to the following conditions :
+
+//The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <RNN.h>
+#include <DataConversionUtils.h>
+#include <defs.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace BAnalyzerNative;
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	/// <summary>
+	/// Parameters of the benchmark run (can be adjusted from the command line).
+	/// </summary>
+	struct BenchmarkSettings
+	{
+		int eval_iterations{ 2000 };
+		int train_iterations{ 50 };
+		int batch_size{ 32 };
+		long long conversion_size{ 1 << 20 };
+		int conversion_iterations{ 50 };
+		std::string output_file_path{};
+	};
+
+	/// <summary>
+	/// Configuration of a net to benchmark.
+	/// </summary>
+	struct NetConfig
+	{
+		int time_depth;
+		std::vector<int> layer_item_sizes;
+	};
+
+	/// <summary>
+	/// Returns name of the precision the native library is compiled with.
+	/// </summary>
+	const char* precision_name()
+	{
+		return sizeof(DeepLearning::Real) == sizeof(float) ? "single" : "double";
+	}
+
+	/// <summary>
+	/// Returns string representation of the given layer item sizes ("10-20-10").
+	/// </summary>
+	std::string to_string(const std::vector<int>& layer_item_sizes)
+	{
+		std::string result;
+
+		for (const auto size : layer_item_sizes)
+			result += (result.empty() ? "" : "-") + std::to_string(size);
+
+		return result;
+	}
+
+	/// <summary>
+	/// Returns the given percentile of the given collection of samples (sorts the collection).
+	/// </summary>
+	double percentile(std::vector<double>& samples, const double fraction)
+	{
+		std::ranges::sort(samples);
+		const auto id = static_cast<std::size_t>(fraction * static_cast<double>(samples.size() - 1));
+		return samples[id];
+	}
+
+	/// <summary>
+	/// Returns a collection of the given size filled with random values from [0, 1).
+	/// </summary>
+	template <class T>
+	std::vector<T> generate_random(const std::size_t size, std::mt19937& generator)
+	{
+		std::uniform_real_distribution<T> distribution(0, 1);
+		std::vector<T> result(size);
+		std::ranges::generate(result, [&]() { return distribution(generator); });
+		return result;
+	}
+
+	/// <summary>
+	/// Returns time in seconds elapsed since the given moment.
+	/// </summary>
+	double seconds_since(const Clock::time_point& start)
+	{
+		return std::chrono::duration<double>(Clock::now() - start).count();
+	}
+
+	/// <summary>
+	/// Writes a record of the net benchmark in JSON format (one record per line).
+	/// </summary>
+	void write_record(std::ostream& out, const char* benchmark, const NetConfig& config, const std::string& metrics)
+	{
+		out << "{\"benchmark\":\"" << benchmark << "\",\"precision\":\"" << precision_name()
+			<< "\",\"depth\":" << config.time_depth << ",\"layers\":\"" << to_string(config.layer_item_sizes)
+			<< "\"," << metrics << "}" << std::endl;
+	}
+
+	/// <summary>
+	/// Measures latency of a single-item evaluation.
+	/// </summary>
+	void benchmark_evaluate(const RNN& net, const NetConfig& config, const BenchmarkSettings& settings,
+		std::mt19937& generator, std::ostream& out)
+	{
+		const auto in_size = net.in_size().xyz.coord_prod() * net.in_size().w;
+		const auto out_size = static_cast<int>(net.out_size().xyz.coord_prod() * net.out_size().w);
+		const auto input = generate_random<double>(in_size, generator);
+		std::vector<double> output(out_size);
+		std::vector<double> latencies(settings.eval_iterations);
+
+		net.evaluate(static_cast<int>(in_size), input.data(), out_size, output.data()); // warm-up
+
+		const auto total_start = Clock::now();
+
+		for (auto& latency : latencies)
+		{
+			const auto start = Clock::now();
+			net.evaluate(static_cast<int>(in_size), input.data(), out_size, output.data());
+			latency = seconds_since(start) * 1e6;
+		}
+
+		const auto total_time = seconds_since(total_start);
+
+		write_record(out, "evaluate", config,
+			"\"p50_us\":" + std::to_string(percentile(latencies, 0.5)) +
+			",\"p99_us\":" + std::to_string(percentile(latencies, 0.99)) +
+			",\"items_per_sec\":" + std::to_string(settings.eval_iterations / total_time));
+	}
+
+	/// <summary>
+	/// Measures throughput of the batch evaluation with double and single precision data.
+	/// </summary>
+	template <class T>
+	void benchmark_evaluate_batch(const RNN& net, const NetConfig& config, const BenchmarkSettings& settings,
+		std::mt19937& generator, std::ostream& out)
+	{
+		const auto in_size = net.in_size().xyz.coord_prod() * net.in_size().w;
+		const auto out_size = net.out_size().xyz.coord_prod() * net.out_size().w;
+		const auto input = generate_random<T>(in_size * settings.batch_size, generator);
+		std::vector<T> output(out_size * settings.batch_size);
+		const auto iterations = std::max(1, settings.eval_iterations / settings.batch_size);
+
+		net.evaluate_batch(static_cast<int>(input.size()), input.data(), static_cast<int>(output.size()), output.data());
+
+		const auto start = Clock::now();
+
+		for (auto iter_id = 0; iter_id < iterations; ++iter_id)
+			net.evaluate_batch(static_cast<int>(input.size()), input.data(), static_cast<int>(output.size()), output.data());
+
+		const auto time = seconds_since(start);
+
+		write_record(out, sizeof(T) == sizeof(float) ? "evaluate_batch_float" : "evaluate_batch_double", config,
+			"\"batch_size\":" + std::to_string(settings.batch_size) +
+			",\"items_per_sec\":" + std::to_string(iterations * settings.batch_size / time));
+	}
+
+	/// <summary>
+	/// Measures throughput of the training.
+	/// </summary>
+	void benchmark_train(RNN& net, const NetConfig& config, const BenchmarkSettings& settings,
+		std::mt19937& generator, std::ostream& out)
+	{
+		const auto in_size = net.in_size().xyz.coord_prod() * net.in_size().w;
+		const auto out_size = net.out_size().xyz.coord_prod() * net.out_size().w;
+		const auto input = generate_random<double>(in_size * settings.batch_size, generator);
+		const auto reference = generate_random<double>(out_size * settings.batch_size, generator);
+
+		const auto max_thread_count = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+		for (const auto thread_count : { 1, max_thread_count })
+		{
+			net.set_thread_count(thread_count);
+			const auto start = Clock::now();
+
+			for (auto iter_id = 0; iter_id < settings.train_iterations; ++iter_id)
+				net.train(static_cast<int>(input.size()), input.data(),
+					static_cast<int>(reference.size()), reference.data(), 0.01);
+
+			const auto time = seconds_since(start);
+
+			write_record(out, "train", config,
+				"\"batch_size\":" + std::to_string(settings.batch_size) +
+				",\"threads\":" + std::to_string(net.thread_count()) +
+				",\"samples_per_sec\":" + std::to_string(settings.train_iterations * settings.batch_size / time));
+		}
+
+		net.set_thread_count(1);
+	}
+
+	/// <summary>
+	/// Measures bandwidth of the data conversion to and from the internal precision of the net.
+	/// </summary>
+	template <class T>
+	void benchmark_conversion(const BenchmarkSettings& settings, std::mt19937& generator, std::ostream& out)
+	{
+		const auto src = generate_random<T>(settings.conversion_size, generator);
+		std::vector<DeepLearning::Real> real(settings.conversion_size);
+		std::vector<T> dest(settings.conversion_size);
+
+		auto start = Clock::now();
+
+		for (auto iter_id = 0; iter_id < settings.conversion_iterations; ++iter_id)
+			DataConversionUtils::to_real(src.data(), settings.conversion_size, real.data());
+
+		const auto to_real_time = seconds_since(start);
+		start = Clock::now();
+
+		for (auto iter_id = 0; iter_id < settings.conversion_iterations; ++iter_id)
+			DataConversionUtils::from_real(real.data(), settings.conversion_size, dest.data());
+
+		const auto from_real_time = seconds_since(start);
+		const auto element_count = static_cast<double>(settings.conversion_size) * settings.conversion_iterations;
+
+		out << "{\"benchmark\":\"conversion\",\"precision\":\"" << precision_name()
+			<< "\",\"external_type\":\"" << (sizeof(T) == sizeof(float) ? "float" : "double")
+			<< "\",\"elements\":" << settings.conversion_size
+			<< ",\"to_real_gelem_per_sec\":" << element_count / to_real_time * 1e-9
+			<< ",\"from_real_gelem_per_sec\":" << element_count / from_real_time * 1e-9 << "}" << std::endl;
+	}
+
+	/// <summary>
+	/// Parses command line arguments.
+	/// </summary>
+	BenchmarkSettings parse_arguments(const int argc, char** argv)
+	{
+		BenchmarkSettings result;
+
+		for (auto arg_id = 1; arg_id + 1 < argc; arg_id += 2)
+		{
+			const std::string name = argv[arg_id];
+			const std::string value = argv[arg_id + 1];
+
+			if (name == "--eval-iterations")
+				result.eval_iterations = std::stoi(value);
+			else if (name == "--train-iterations")
+				result.train_iterations = std::stoi(value);
+			else if (name == "--batch-size")
+				result.batch_size = std::stoi(value);
+			else if (name == "--conversion-size")
+				result.conversion_size = std::stoll(value);
+			else if (name == "--output")
+				result.output_file_path = value;
+			else
+				throw std::exception("Unknown argument.");
+		}
+
+		return result;
+	}
+}
+
+/// <summary>
+/// Runs benchmarks of the native library and writes the results as JSON records (one per line)
+/// either to the standard output or to the file given with the "--output" argument.
+/// </summary>
+int main(int argc, char** argv)
+{
+	try
+	{
+		const auto settings = parse_arguments(argc, argv);
+		std::ofstream file;
+
+		if (!settings.output_file_path.empty())
+			file.open(settings.output_file_path);
+
+		std::ostream& out = settings.output_file_path.empty() ? std::cout : file;
+		std::mt19937 generator(0);
+
+		const std::vector<NetConfig> configs = {
+			{ 5, { 10, 10, 10 } },
+			{ 20, { 10, 10, 10 } },
+			{ 10, { 32, 64, 32 } },
+			{ 10, { 128, 128, 64 } },
+			{ 40, { 32, 64, 32 } },
+		};
+
+		for (const auto& config : configs)
+		{
+			RNN net(config.time_depth, static_cast<int>(config.layer_item_sizes.size()), config.layer_item_sizes.data());
+			benchmark_evaluate(net, config, settings, generator, out);
+			benchmark_evaluate_batch<double>(net, config, settings, generator, out);
+			benchmark_evaluate_batch<float>(net, config, settings, generator, out);
+			benchmark_train(net, config, settings, generator, out);
+		}
+
+		benchmark_conversion<double>(settings, generator, out);
+		benchmark_conversion<float>(settings, generator, out);
+	} catch (const std::exception& e)
+	{
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
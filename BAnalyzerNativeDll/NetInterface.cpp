@@ -17,15 +17,18 @@
 
 #include "NetInterface.h"
 #include <RNN.h>
+#include <KLineFeatures.h>
+#include <algorithm>
 
 __declspec(dllexport) RNN* RnnConstruct(const int time_depth,
-	const int layer_item_sizes_count, const int* layer_item_sizes)
+	const int layer_item_sizes_count, const int* layer_item_sizes, const int* layer_activations, const int cost)
 {
 	RNN* result{};
 
 	try
 	{
-		result = new RNN(time_depth, layer_item_sizes_count, layer_item_sizes);
+		result = new RNN(time_depth, layer_item_sizes_count, layer_item_sizes,
+			reinterpret_cast<const RnnActivation*>(layer_activations), static_cast<RnnCost>(cost));
 
 	} catch (...)
 	{
@@ -53,6 +56,57 @@ __declspec(dllexport) bool RnnFree(const RNN* net_ptr)
 	return true;
 }
 
+bool RnnSave(const RNN* net_ptr, const wchar_t* file_path, const int weight_precision)
+{
+	if (!net_ptr || !file_path)
+		return false;
+
+	try
+	{
+		net_ptr->save(file_path, static_cast<WeightPrecision>(weight_precision));
+	} catch(...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+RNN* RnnLoad(const wchar_t* file_path)
+{
+	if (!file_path)
+		return nullptr;
+
+	try
+	{
+		return RNN::load(file_path).release();
+	} catch (...)
+	{
+		return nullptr;
+	}
+}
+
+bool RnnFreeze(RNN* net_ptr)
+{
+	if (!net_ptr)
+		return false;
+
+	try
+	{
+		net_ptr->freeze();
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool RnnIsFrozen(const RNN* net_ptr)
+{
+	return net_ptr && net_ptr->is_frozen();
+}
+
 int RnnGetInputItemSize(const RNN* net_ptr)
 {
 	if (net_ptr)
@@ -96,6 +150,28 @@ bool RnnEvaluate(const RNN* net_ptr, const int size, const double* input,
 	try
 	{
 		net_ptr->evaluate(size, input, output);
+		BANALYZER_SCOPED_TIMER(net_ptr->stats().callback_time_ns);
+		get_result_callback(static_cast<int>(output.size()), output.begin());
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool RnnEvaluateBatch(const RNN* net_ptr, const int in_aggregate_size, const double* input_aggregate,
+	const GetArrayCallBack get_result_callback)
+{
+	if (!net_ptr)
+		return false;
+
+	thread_local DeepLearning::LazyVector<double> output{};
+
+	try
+	{
+		net_ptr->evaluate_batch(in_aggregate_size, input_aggregate, output);
+		BANALYZER_SCOPED_TIMER(net_ptr->stats().callback_time_ns);
 		get_result_callback(static_cast<int>(output.size()), output.begin());
 	} catch (...)
 	{
@@ -105,6 +181,97 @@ bool RnnEvaluate(const RNN* net_ptr, const int size, const double* input,
 	return true;
 }
 
+int RnnEvaluateToBuffer(const RNN* net_ptr, const int size, const double* input,
+	const int output_capacity, double* output)
+{
+	if (!net_ptr)
+		return -1;
+
+	try
+	{
+		return net_ptr->evaluate(size, input, output_capacity, output);
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+int RnnEvaluateBatchToBuffer(const RNN* net_ptr, const int in_aggregate_size, const double* input_aggregate,
+	const int output_capacity, double* output_aggregate)
+{
+	if (!net_ptr)
+		return -1;
+
+	try
+	{
+		return net_ptr->evaluate_batch(in_aggregate_size, input_aggregate, output_capacity, output_aggregate);
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+int RnnEvaluateBatchToBufferSingle(const RNN* net_ptr, const int in_aggregate_size, const float* input_aggregate,
+	const int output_capacity, float* output_aggregate)
+{
+	if (!net_ptr)
+		return -1;
+
+	try
+	{
+		return net_ptr->evaluate_batch(in_aggregate_size, input_aggregate, output_capacity, output_aggregate);
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+RNN::EvalContext* RnnAcquireContext(const RNN* net_ptr)
+{
+	if (!net_ptr)
+		return nullptr;
+
+	try
+	{
+		return net_ptr->acquire_context();
+	} catch (...)
+	{
+		return nullptr;
+	}
+}
+
+bool RnnReleaseContext(const RNN* net_ptr, RNN::EvalContext* context_ptr)
+{
+	if (!net_ptr || !context_ptr)
+		return false;
+
+	try
+	{
+		net_ptr->release_context(context_ptr);
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+int RnnEvaluateBatchInContext(const RNN* net_ptr, RNN::EvalContext* context_ptr, const int in_aggregate_size,
+	const double* input_aggregate, const int output_capacity, double* output_aggregate)
+{
+	if (!net_ptr || !context_ptr)
+		return -1;
+
+	try
+	{
+		return net_ptr->evaluate_batch(in_aggregate_size, input_aggregate, output_capacity,
+			output_aggregate, *context_ptr);
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
 bool RnnBatchTrain(RNN* net_ptr, const int in_aggregate_size,
 	const double* input_aggregate, const int ref_aggregate_size,
 	const double* reference_aggregate, const double learning_rate)
@@ -124,6 +291,955 @@ bool RnnBatchTrain(RNN* net_ptr, const int in_aggregate_size,
 	return true;
 }
 
+bool RnnBatchTrainSingle(RNN* net_ptr, const int in_aggregate_size,
+	const float* input_aggregate, const int ref_aggregate_size,
+	const float* reference_aggregate, const double learning_rate)
+{
+	if (!net_ptr)
+		return false;
+
+	try
+	{
+		net_ptr->train(in_aggregate_size, input_aggregate, ref_aggregate_size,
+			reference_aggregate, learning_rate);
+	} catch(...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool RnnFit(RNN* net_ptr, const int in_aggregate_size, const double* input_aggregate,
+	const int ref_aggregate_size, const double* reference_aggregate, const FitOptions* options, FitResult* result)
+{
+	if (!net_ptr || !options || !result)
+		return false;
+
+	try
+	{
+		*result = net_ptr->fit(in_aggregate_size, input_aggregate, ref_aggregate_size,
+			reference_aggregate, *options);
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool RnnTrainSeries(RNN* net_ptr, const int series_size, const double* input_series,
+	const int ref_series_size, const double* reference_series, const int stride, const double learning_rate)
+{
+	if (!net_ptr)
+		return false;
+
+	try
+	{
+		net_ptr->train_series(series_size, input_series, ref_series_size, reference_series, stride, learning_rate);
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool RnnTrainSequences(RNN* net_ptr, const int sequence_count, const int* sequence_lengths,
+	const int series_size, const double* input_series, const int ref_series_size,
+	const double* reference_series, const int truncation_length, const double learning_rate)
+{
+	if (!net_ptr)
+		return false;
+
+	try
+	{
+		net_ptr->train_sequences(sequence_count, sequence_lengths, series_size, input_series,
+			ref_series_size, reference_series, truncation_length, learning_rate);
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool RnnFitSeries(RNN* net_ptr, const int series_size, const double* input_series, const int ref_series_size,
+	const double* reference_series, const int stride, const FitOptions* options, FitResult* result)
+{
+	if (!net_ptr || !options || !result)
+		return false;
+
+	try
+	{
+		*result = net_ptr->fit_series(series_size, input_series, ref_series_size,
+			reference_series, stride, *options);
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+TrainJob* RnnTrainAsync(RNN* net_ptr, const int in_aggregate_size, const double* input_aggregate,
+	const int ref_aggregate_size, const double* reference_aggregate, const FitOptions* options,
+	const EpochCostCallBack epoch_callback)
+{
+	if (!net_ptr || !options)
+		return nullptr;
+
+	try
+	{
+		EpochCallback on_epoch{};
+
+		if (epoch_callback)
+			on_epoch = [epoch_callback](const int epoch_id, const double cost) { epoch_callback(epoch_id, cost); };
+
+		return new TrainJob(*net_ptr, in_aggregate_size, input_aggregate, ref_aggregate_size,
+			reference_aggregate, *options, std::move(on_epoch));
+	} catch (...)
+	{
+		return nullptr;
+	}
+}
+
+bool RnnJobCancel(TrainJob* job_ptr)
+{
+	if (!job_ptr)
+		return false;
+
+	job_ptr->cancel();
+
+	return true;
+}
+
+int RnnJobWait(const TrainJob* job_ptr, const int timeout_ms)
+{
+	if (!job_ptr)
+		return -1;
+
+	try
+	{
+		return static_cast<int>(job_ptr->wait(timeout_ms));
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+bool RnnJobGetResult(const TrainJob* job_ptr, FitResult* result)
+{
+	if (!job_ptr || !result || job_ptr->status() == TrainJob::Status::Running)
+		return false;
+
+	*result = job_ptr->result();
+
+	return true;
+}
+
+bool RnnJobFree(const TrainJob* job_ptr)
+{
+	if (!job_ptr)
+		return false;
+
+	try
+	{
+		delete job_ptr;
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool RnnSetThreadCount(RNN* net_ptr, const int thread_count)
+{
+	if (!net_ptr)
+		return false;
+
+	try
+	{
+		net_ptr->set_thread_count(thread_count);
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+int RnnGetThreadCount(const RNN* net_ptr)
+{
+	if (net_ptr)
+		return net_ptr->thread_count();
+
+	return -1;
+}
+
+bool RnnSetOptimizer(RNN* net_ptr, const OptimizerOptions* options)
+{
+	if (!net_ptr || !options)
+		return false;
+
+	try
+	{
+		net_ptr->set_optimizer(*options);
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool RnnGetOptimizer(const RNN* net_ptr, OptimizerOptions* options)
+{
+	if (!net_ptr || !options)
+		return false;
+
+	*options = net_ptr->optimizer_options();
+
+	return true;
+}
+
+bool RnnReserveScratch(RNN* net_ptr, const int max_batch_size, const int eval_context_count)
+{
+	if (!net_ptr)
+		return false;
+
+	try
+	{
+		net_ptr->reserve_scratch(max_batch_size, eval_context_count);
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+long long RnnGetScratchFootprint(const RNN* net_ptr)
+{
+	if (net_ptr)
+		return static_cast<long long>(net_ptr->scratch_footprint());
+
+	return -1;
+}
+
+bool RnnSetScratchLimit(RNN* net_ptr, const long long limit_bytes)
+{
+	if (!net_ptr || limit_bytes < 0)
+		return false;
+
+	net_ptr->set_scratch_limit(static_cast<std::size_t>(limit_bytes));
+
+	return true;
+}
+
+long long RnnGetScratchLimit(const RNN* net_ptr)
+{
+	if (net_ptr)
+		return static_cast<long long>(net_ptr->scratch_limit());
+
+	return -1;
+}
+
+RNNStream* RnnStreamOpen(const RNN* net_ptr)
+{
+	if (!net_ptr)
+		return nullptr;
+
+	try
+	{
+		return new RNNStream(*net_ptr);
+	} catch (...)
+	{
+		return nullptr;
+	}
+}
+
+int RnnStreamPush(RNNStream* stream_ptr, const int item_size, const double* item,
+	const int output_capacity, double* output)
+{
+	if (!stream_ptr)
+		return -1;
+
+	try
+	{
+		return stream_ptr->push(item_size, item, output_capacity, output);
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+bool RnnStreamReset(RNNStream* stream_ptr)
+{
+	if (!stream_ptr)
+		return false;
+
+	stream_ptr->reset();
+
+	return true;
+}
+
+bool RnnStreamClose(const RNNStream* stream_ptr)
+{
+	if (!stream_ptr)
+		return false;
+
+	try
+	{
+		delete stream_ptr;
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+RNNMultiStream* RnnMultiStreamOpen(const RNN* net_ptr, const int stream_count)
+{
+	if (!net_ptr)
+		return nullptr;
+
+	try
+	{
+		return new RNNMultiStream(*net_ptr, stream_count);
+	} catch (...)
+	{
+		return nullptr;
+	}
+}
+
+int RnnMultiStreamPushAll(RNNMultiStream* multi_stream_ptr, const int aggregate_size, const double* items)
+{
+	if (!multi_stream_ptr)
+		return -1;
+
+	try
+	{
+		return multi_stream_ptr->push_all(aggregate_size, items);
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+int RnnMultiStreamReadAll(const RNNMultiStream* multi_stream_ptr, const int output_capacity, double* output)
+{
+	if (!multi_stream_ptr)
+		return -1;
+
+	try
+	{
+		return multi_stream_ptr->read_all(output_capacity, output);
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+bool RnnMultiStreamReset(RNNMultiStream* multi_stream_ptr)
+{
+	if (!multi_stream_ptr)
+		return false;
+
+	multi_stream_ptr->reset();
+
+	return true;
+}
+
+bool RnnMultiStreamClose(const RNNMultiStream* multi_stream_ptr)
+{
+	if (!multi_stream_ptr)
+		return false;
+
+	try
+	{
+		delete multi_stream_ptr;
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool RnnSweep(const int candidate_count, const int* time_depths, const int* layer_counts,
+	const int* layer_item_sizes, const int* layer_activations, const int cost, const int series_size,
+	const double* input_series, const int ref_series_size, const double* reference_series, const int stride,
+	const FitOptions* options, const int thread_count, RNN** nets, SweepResult* results)
+{
+	if (candidate_count <= 0 || !time_depths || !layer_counts || !layer_item_sizes || !options || !nets || !results)
+		return false;
+
+	try
+	{
+		std::vector<SweepCandidate> candidates(candidate_count);
+		auto item_sizes_begin = layer_item_sizes;
+		auto activations_begin = reinterpret_cast<const RnnActivation*>(layer_activations);
+
+		for (auto candidate_id = 0; candidate_id < candidate_count; ++candidate_id)
+		{
+			const auto layer_count = layer_counts[candidate_id];
+
+			if (layer_count < 2)
+				return false;
+
+			auto& candidate = candidates[candidate_id];
+			candidate.time_depth = time_depths[candidate_id];
+			candidate.layer_item_sizes.assign(item_sizes_begin, item_sizes_begin + layer_count);
+			item_sizes_begin += layer_count;
+
+			if (activations_begin)
+			{
+				candidate.activations.assign(activations_begin, activations_begin + layer_count - 1);
+				activations_begin += layer_count - 1;
+			}
+		}
+
+		std::vector<std::unique_ptr<RNN>> trained_nets;
+		const auto ranked = RNNSweep::run(candidates, static_cast<RnnCost>(cost), series_size, input_series,
+			ref_series_size, reference_series, stride, *options, thread_count, trained_nets);
+
+		std::ranges::copy(ranked, results);
+
+		for (auto candidate_id = 0; candidate_id < candidate_count; ++candidate_id)
+			nets[candidate_id] = trained_nets[candidate_id].release();
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+RNNEnsemble* RnnEnsembleConstruct(const int member_count, const RNN* const* members, const double* weights)
+{
+	try
+	{
+		return new RNNEnsemble(member_count, members, weights);
+	} catch (...)
+	{
+		return nullptr;
+	}
+}
+
+int RnnEnsembleEvaluate(RNNEnsemble* ensemble_ptr, const int size, const double* input,
+	const int output_capacity, double* output, const int member_output_capacity, double* member_outputs)
+{
+	if (!ensemble_ptr)
+		return -1;
+
+	try
+	{
+		return ensemble_ptr->evaluate(size, input, output_capacity, output, member_output_capacity, member_outputs);
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+int RnnEnsembleGetDepth(const RNNEnsemble* ensemble_ptr)
+{
+	if (!ensemble_ptr)
+		return -1;
+
+	return ensemble_ptr->depth();
+}
+
+bool RnnEnsembleFree(const RNNEnsemble* ensemble_ptr)
+{
+	if (!ensemble_ptr)
+		return false;
+
+	try
+	{
+		delete ensemble_ptr;
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+SeriesAnomalyDetector* AnomalyDetectorConstruct(const int kind, const int history_length, const double confidence)
+{
+	try
+	{
+		return new SeriesAnomalyDetector(static_cast<AnomalyKind>(kind), history_length, confidence);
+	} catch (...)
+	{
+		return nullptr;
+	}
+}
+
+int AnomalyDetectorPush(SeriesAnomalyDetector* detector_ptr, const int count,
+	const double* values, const int capacity, int* anomaly_ids)
+{
+	if (!detector_ptr)
+		return -1;
+
+	try
+	{
+		return detector_ptr->push(count, values, capacity, anomaly_ids);
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+bool AnomalyDetectorReset(SeriesAnomalyDetector* detector_ptr)
+{
+	if (!detector_ptr)
+		return false;
+
+	detector_ptr->reset();
+
+	return true;
+}
+
+bool AnomalyDetectorFree(const SeriesAnomalyDetector* detector_ptr)
+{
+	if (!detector_ptr)
+		return false;
+
+	try
+	{
+		delete detector_ptr;
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+IndicatorEngine* IndicatorEngineConstruct(const int spec_count, const IndicatorSpec* specs)
+{
+	try
+	{
+		return new IndicatorEngine(spec_count, specs);
+	} catch (...)
+	{
+		return nullptr;
+	}
+}
+
+int IndicatorEngineUpdate(IndicatorEngine* engine_ptr, const int kline_count,
+	const double* high_price, const double* low_price, const double* close_price, const double* volume,
+	const int output_capacity, double* output)
+{
+	if (!engine_ptr)
+		return -1;
+
+	try
+	{
+		const KLineColumns columns{ kline_count, nullptr, high_price, low_price, close_price, volume, nullptr };
+		return engine_ptr->update(columns, output_capacity, output);
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+long long IndicatorEngineGetKLineCount(const IndicatorEngine* engine_ptr)
+{
+	if (!engine_ptr)
+		return -1;
+
+	return engine_ptr->kline_count();
+}
+
+bool IndicatorEngineReset(IndicatorEngine* engine_ptr)
+{
+	if (!engine_ptr)
+		return false;
+
+	engine_ptr->reset();
+
+	return true;
+}
+
+bool IndicatorEngineFree(const IndicatorEngine* engine_ptr)
+{
+	if (!engine_ptr)
+		return false;
+
+	try
+	{
+		delete engine_ptr;
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+int KLineResample(const int count, const PackedKLine* items,
+	const long long span_ms, const long long origin_ms, const int output_capacity, PackedKLine* output)
+{
+	try
+	{
+		return KLineResampler::resample(count, items, span_ms, origin_ms, output_capacity, output);
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+KLineResampler* KLineResamplerConstruct(const long long span_ms, const long long origin_ms)
+{
+	try
+	{
+		return new KLineResampler(span_ms, origin_ms);
+	} catch (...)
+	{
+		return nullptr;
+	}
+}
+
+int KLineResamplerPush(KLineResampler* resampler_ptr, const int count,
+	const PackedKLine* items, const int output_capacity, PackedKLine* output)
+{
+	if (!resampler_ptr)
+		return -1;
+
+	try
+	{
+		return resampler_ptr->push(count, items, output_capacity, output);
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+bool KLineResamplerGetOpenBar(const KLineResampler* resampler_ptr, PackedKLine* bar)
+{
+	if (!resampler_ptr || !bar)
+		return false;
+
+	return resampler_ptr->get_open_bar(*bar);
+}
+
+bool KLineResamplerReset(KLineResampler* resampler_ptr)
+{
+	if (!resampler_ptr)
+		return false;
+
+	resampler_ptr->reset();
+
+	return true;
+}
+
+bool KLineResamplerFree(const KLineResampler* resampler_ptr)
+{
+	if (!resampler_ptr)
+		return false;
+
+	try
+	{
+		delete resampler_ptr;
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool KLineArchiveWrite(const wchar_t* file_path, const int block_count,
+	const int* block_sizes, const PackedKLine* items, const bool compress)
+{
+	if (!file_path)
+		return false;
+
+	try
+	{
+		KLineArchive::write(file_path, block_count, block_sizes, items, compress);
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+KLineArchive* KLineArchiveOpen(const wchar_t* file_path)
+{
+	if (!file_path)
+		return nullptr;
+
+	try
+	{
+		return new KLineArchive(file_path);
+	} catch (...)
+	{
+		return nullptr;
+	}
+}
+
+int KLineArchiveGetBlockCount(const KLineArchive* archive_ptr)
+{
+	if (!archive_ptr)
+		return -1;
+
+	return archive_ptr->block_count();
+}
+
+bool KLineArchiveGetBlockInfo(const KLineArchive* archive_ptr, const int block_id, ArchiveBlockInfo* info)
+{
+	if (!archive_ptr || !info)
+		return false;
+
+	try
+	{
+		*info = archive_ptr->block_info(block_id);
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+int KLineArchiveRead(const KLineArchive* archive_ptr, const int block_id,
+	const int begin_kline_id, const int count, PackedKLine* output)
+{
+	if (!archive_ptr)
+		return -1;
+
+	try
+	{
+		return archive_ptr->read(block_id, begin_kline_id, count, output);
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+bool KLineArchiveFree(const KLineArchive* archive_ptr)
+{
+	if (!archive_ptr)
+		return false;
+
+	try
+	{
+		delete archive_ptr;
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+OrderBook* OrderBookConstruct()
+{
+	try
+	{
+		return new OrderBook();
+	} catch (...)
+	{
+		return nullptr;
+	}
+}
+
+bool OrderBookApplySnapshot(OrderBook* book_ptr, const long long update_id,
+	const int bid_count, const double* bid_prices, const double* bid_quantities,
+	const int ask_count, const double* ask_prices, const double* ask_quantities)
+{
+	if (!book_ptr)
+		return false;
+
+	try
+	{
+		book_ptr->apply_snapshot(update_id, bid_count, bid_prices, bid_quantities,
+			ask_count, ask_prices, ask_quantities);
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+int OrderBookApplyDiff(OrderBook* book_ptr,
+	const long long first_update_id, const long long last_update_id,
+	const int bid_count, const double* bid_prices, const double* bid_quantities,
+	const int ask_count, const double* ask_prices, const double* ask_quantities)
+{
+	if (!book_ptr)
+		return -1;
+
+	try
+	{
+		return static_cast<int>(book_ptr->apply_diff(first_update_id, last_update_id,
+			bid_count, bid_prices, bid_quantities, ask_count, ask_prices, ask_quantities));
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+long long OrderBookGetUpdateId(const OrderBook* book_ptr)
+{
+	if (!book_ptr)
+		return -1;
+
+	return book_ptr->update_id();
+}
+
+int OrderBookGetLevelCount(const OrderBook* book_ptr, const int side)
+{
+	if (!book_ptr)
+		return -1;
+
+	try
+	{
+		return book_ptr->level_count(static_cast<OrderBookSide>(side));
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+int OrderBookGetDepth(const OrderBook* book_ptr, const int side, const int capacity,
+	double* prices, double* quantities, double* cumulative)
+{
+	if (!book_ptr)
+		return -1;
+
+	try
+	{
+		return book_ptr->get_depth(static_cast<OrderBookSide>(side), capacity, prices, quantities, cumulative);
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+int OrderBookAggregate(OrderBook* book_ptr, const int side, const double bucket_size,
+	const int capacity, double* prices, double* quantities, double* cumulative)
+{
+	if (!book_ptr)
+		return -1;
+
+	try
+	{
+		return book_ptr->aggregate(static_cast<OrderBookSide>(side), bucket_size,
+			capacity, prices, quantities, cumulative);
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+bool OrderBookFree(const OrderBook* book_ptr)
+{
+	if (!book_ptr)
+		return false;
+
+	try
+	{
+		delete book_ptr;
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+int RnnEvaluateArchiveBlock(const RNN* net_ptr, const KLineArchive* archive_ptr,
+	const int block_id, const int normalization_window, const int output_capacity, double* output)
+{
+	if (!net_ptr || !archive_ptr)
+		return -1;
+
+	try
+	{
+		return KLineFeatures::evaluate(*net_ptr, archive_ptr->columns(block_id),
+			normalization_window, output_capacity, output);
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+int KLineFeatureCount()
+{
+	return KLineFeatures::FeatureCount;
+}
+
+int RnnEvaluateKLines(const RNN* net_ptr, const int kline_count,
+	const double* open_price, const double* high_price, const double* low_price, const double* close_price,
+	const double* volume, const int* trade_count, const int normalization_window,
+	const int output_capacity, double* output)
+{
+	if (!net_ptr)
+		return -1;
+
+	try
+	{
+		const KLineColumns columns{ kline_count, open_price, high_price, low_price, close_price, volume, trade_count };
+		return KLineFeatures::evaluate(*net_ptr, columns, normalization_window, output_capacity, output);
+	} catch (...)
+	{
+		return -1;
+	}
+}
+
+bool RnnTrainKLines(RNN* net_ptr, const int kline_count,
+	const double* open_price, const double* high_price, const double* low_price, const double* close_price,
+	const double* volume, const int* trade_count, const int normalization_window, const double learning_rate)
+{
+	if (!net_ptr)
+		return false;
+
+	try
+	{
+		const KLineColumns columns{ kline_count, open_price, high_price, low_price, close_price, volume, trade_count };
+		KLineFeatures::train(*net_ptr, columns, normalization_window, learning_rate);
+	} catch (...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool RnnGetStats(const RNN* net_ptr, RnnStats* stats)
+{
+	if (!net_ptr || !stats)
+		return false;
+
+	*stats = net_ptr->stats().snapshot();
+
+	return true;
+}
+
+bool RnnResetStats(const RNN* net_ptr)
+{
+	if (!net_ptr)
+		return false;
+
+	net_ptr->stats().reset();
+
+	return true;
+}
+
+bool IsInstrumentationEnabled()
+{
+	return BANALYZER_INSTRUMENTATION != 0;
+}
+
 bool IsSinglePrecision()
 {
 	return std::is_same_v<DeepLearning::Real, float>;
@@ -16,7 +16,17 @@
 //SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #pragma once
+#include <IndicatorEngine.h>
+#include <KLineArchive.h>
+#include <KLineResampler.h>
+#include <OrderBook.h>
 #include <RNN.h>
+#include <RNNStream.h>
+#include <RNNMultiStream.h>
+#include <RNNEnsemble.h>
+#include <RNNSweep.h>
+#include <SeriesAnomalyDetector.h>
+#include <TrainJob.h>
 
 using namespace BAnalyzerNative;
 
@@ -24,10 +34,13 @@ extern "C"
 {
 	/// <summary>
 	/// Returns a pointer to a recurrent neural net constructed according to the given set of parameters.
+	/// <paramref name="layer_activations"/> contains "RnnActivation" values of the layers
+	/// ("layer_item_sizes_count - 1" items, "null" means sigmoid for all the layers)
+	/// and <paramref name="cost"/> is an "RnnCost" value.
 	///	Returns "null" if fails.
 	/// </summary>
 	__declspec(dllexport) RNN* RnnConstruct(const int time_depth,
-		const int layer_item_sizes_count, const int* layer_item_sizes);
+		const int layer_item_sizes_count, const int* layer_item_sizes, const int* layer_activations, const int cost);
 
 	/// <summary>
 	/// Returns size of a single input time-point item of the net represented with <paramref name="net_ptr"/>.
@@ -65,6 +78,59 @@ extern "C"
 	__declspec(dllexport) bool RnnEvaluate(const RNN* net_ptr,
 		const int size, const double* input, const GetArrayCallBack get_result_callback);
 
+	/// <summary>
+	/// Evaluates neural net at each of the input items packed into the given <paramref name="input_aggregate"/>
+	/// and passes concatenation of the results to the given callback (in a single call).
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnEvaluateBatch(const RNN* net_ptr,
+		const int in_aggregate_size, const double* input_aggregate, const GetArrayCallBack get_result_callback);
+
+	/// <summary>
+	/// Evaluates neural net at the given <paramref name="input"/> and writes the result
+	/// into the caller-provided buffer <paramref name="output"/> of the given capacity.
+	///	Returns number of elements written or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int RnnEvaluateToBuffer(const RNN* net_ptr,
+		const int size, const double* input, const int output_capacity, double* output);
+
+	/// <summary>
+	/// Evaluates neural net at each of the input items packed into the given <paramref name="input_aggregate"/>
+	/// and writes concatenation of the results into the caller-provided buffer <paramref name="output_aggregate"/>.
+	///	Returns number of elements written or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int RnnEvaluateBatchToBuffer(const RNN* net_ptr,
+		const int in_aggregate_size, const double* input_aggregate, const int output_capacity, double* output_aggregate);
+
+	/// <summary>
+	/// Single precision version of "RnnEvaluateBatchToBuffer". If the DLL is compiled against "single"
+	/// precision arithmetics (see "IsSinglePrecision"), the data is copied without any conversion.
+	///	Returns number of elements written or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int RnnEvaluateBatchToBufferSingle(const RNN* net_ptr,
+		const int in_aggregate_size, const float* input_aggregate, const int output_capacity, float* output_aggregate);
+
+	/// <summary>
+	/// Returns a pointer to an evaluation context acquired from the pool of the net represented with <paramref name="net_ptr"/>.
+	/// The context is owned by the caller until it is released with "RnnReleaseContext" and must not be used
+	/// by several threads simultaneously. Returns "null" if fails.
+	/// </summary>
+	__declspec(dllexport) RNN::EvalContext* RnnAcquireContext(const RNN* net_ptr);
+
+	/// <summary>
+	/// Returns the given evaluation context back to the pool of the net represented with <paramref name="net_ptr"/>.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnReleaseContext(const RNN* net_ptr, RNN::EvalContext* context_ptr);
+
+	/// <summary>
+	/// The same as "RnnEvaluateBatchToBuffer" but uses the given evaluation context, which allows to evaluate
+	/// the same net from several threads simultaneously without any hidden per-thread data.
+	///	Returns number of elements written or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int RnnEvaluateBatchInContext(const RNN* net_ptr, RNN::EvalContext* context_ptr,
+		const int in_aggregate_size, const double* input_aggregate, const int output_capacity, double* output_aggregate);
+
 	/// <summary>
 	/// Evaluated neural net at the given <paramref name="input_aggregate"/>.
 	///	Returns "true" if succeeded.
@@ -73,12 +139,544 @@ extern "C"
 		const int in_aggregate_size, const double* input_aggregate, const int ref_aggregate_size,
 		const double* reference_aggregate, const double learning_rate);
 
+	/// <summary>
+	/// Single precision version of "RnnBatchTrain". If the DLL is compiled against "single"
+	/// precision arithmetics (see "IsSinglePrecision"), the data is copied without any conversion.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnBatchTrainSingle(RNN* net_ptr,
+		const int in_aggregate_size, const float* input_aggregate, const int ref_aggregate_size,
+		const float* reference_aggregate, const double learning_rate);
+
+	/// <summary>
+	/// Runs a multi-epoch training of the net represented with <paramref name="net_ptr"/> on the given data set
+	/// according to the given <paramref name="options"/> and writes summary of the training into <paramref name="result"/>.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnFit(RNN* net_ptr,
+		const int in_aggregate_size, const double* input_aggregate, const int ref_aggregate_size,
+		const double* reference_aggregate, const FitOptions* options, FitResult* result);
+
+	/// <summary>
+	/// Performs a single-batch training iteration of the net represented with <paramref name="net_ptr"/> on all the
+	/// windows (of the time depth of the net, starting at each <paramref name="stride"/>-th time-point) of the given series.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnTrainSeries(RNN* net_ptr,
+		const int series_size, const double* input_series, const int ref_series_size,
+		const double* reference_series, const int stride, const double learning_rate);
+
+	/// <summary>
+	/// Performs a single-batch training iteration of the net represented with <paramref name="net_ptr"/> on
+	/// <paramref name="sequence_count"/> sequences of the given lengths stored one after another in the given series
+	/// (truncated backpropagation through time with the given <paramref name="truncation_length"/>, see "RNN::train_sequences").
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnTrainSequences(RNN* net_ptr, const int sequence_count, const int* sequence_lengths,
+		const int series_size, const double* input_series, const int ref_series_size,
+		const double* reference_series, const int truncation_length, const double learning_rate);
+
+	/// <summary>
+	/// The same as "RnnFit" but the training pairs are the windows (of the time depth of the net, starting
+	/// at each <paramref name="stride"/>-th time-point) of the given series.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnFitSeries(RNN* net_ptr,
+		const int series_size, const double* input_series, const int ref_series_size,
+		const double* reference_series, const int stride, const FitOptions* options, FitResult* result);
+
+	/// <summary>
+	/// A callback to report progress of a training job (index of the finished epoch and the cost of the net after it).
+	/// </summary>
+	typedef void (*EpochCostCallBack)(const int epoch_id, const double cost);
+
+	/// <summary>
+	/// Starts a multi-epoch training (see "RnnFit") of the net represented with <paramref name="net_ptr"/> on a worker
+	/// thread and returns a handle of the job (to be released with "RnnJobFree"). The training data is copied,
+	/// while the net must not be freed until the job is finished. The optional <paramref name="epoch_callback"/>
+	/// is called on the worker thread after each epoch.
+	///	Returns "null" if fails.
+	/// </summary>
+	__declspec(dllexport) TrainJob* RnnTrainAsync(RNN* net_ptr,
+		const int in_aggregate_size, const double* input_aggregate, const int ref_aggregate_size,
+		const double* reference_aggregate, const FitOptions* options, const EpochCostCallBack epoch_callback);
+
+	/// <summary>
+	/// Requests the given job to stop after the mini-batch that is in progress.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnJobCancel(TrainJob* job_ptr);
+
+	/// <summary>
+	/// Waits until the given job is finished or <paramref name="timeout_ms"/> milliseconds elapse (negative value
+	/// means "no timeout") and returns the status of the job ("TrainJob::Status" value).
+	///	Returns "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int RnnJobWait(const TrainJob* job_ptr, const int timeout_ms);
+
+	/// <summary>
+	/// Writes summary of the training performed by the given (finished) job into <paramref name="result"/>.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnJobGetResult(const TrainJob* job_ptr, FitResult* result);
+
+	/// <summary>
+	/// Cancels the given job, waits until it is finished and frees the pointer.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnJobFree(const TrainJob* job_ptr);
+
+	/// <summary>
+	/// Sets number of worker threads to be used by training of the net represented with <paramref name="net_ptr"/>.
+	/// Each training batch is split into the given number of shards whose gradients are calculated in parallel.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnSetThreadCount(RNN* net_ptr, const int thread_count);
+
+	/// <summary>
+	/// Returns number of worker threads used by training of the net represented with <paramref name="net_ptr"/>.
+	///	Returns "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int RnnGetThreadCount(const RNN* net_ptr);
+
+	/// <summary>
+	/// Sets the optimizer (and the number of gradient accumulation steps) the net represented with
+	/// <paramref name="net_ptr"/> is to be trained with. Discards state of the previous optimizer.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnSetOptimizer(RNN* net_ptr, const OptimizerOptions* options);
+
+	/// <summary>
+	/// Writes parameters of the optimizer the net represented with <paramref name="net_ptr"/> is trained with
+	/// into <paramref name="options"/>. Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnGetOptimizer(const RNN* net_ptr, OptimizerOptions* options);
+
+	/// <summary>
+	/// Pre-sizes the scratch data of the net represented with <paramref name="net_ptr"/> for training batches of up to
+	/// <paramref name="max_batch_size"/> pairs and up to <paramref name="eval_context_count"/> simultaneous evaluations
+	/// (the temporaries allocated inside the layers of the net are not covered).
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnReserveScratch(RNN* net_ptr, const int max_batch_size, const int eval_context_count);
+
+	/// <summary>
+	/// Returns total size (in bytes) of the scratch tensors held by the net represented with <paramref name="net_ptr"/>.
+	///	Returns "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) long long RnnGetScratchFootprint(const RNN* net_ptr);
+
+	/// <summary>
+	/// Sets upper bound (in bytes, "0" means "no limit") of the converted training data of a single batch
+	/// of the net represented with <paramref name="net_ptr"/>.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnSetScratchLimit(RNN* net_ptr, const long long limit_bytes);
+
+	/// <summary>
+	/// Returns upper bound (in bytes, "0" means "no limit") of the converted training data of a single batch
+	/// of the net represented with <paramref name="net_ptr"/>.
+	///	Returns "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) long long RnnGetScratchLimit(const RNN* net_ptr);
+
+	/// <summary>
+	/// Saves the net represented with <paramref name="net_ptr"/> into the file with the given path
+	/// storing the weights with the given precision ("WeightPrecision" value); reduced precision
+	/// makes the file smaller only, the loaded net works with (and can be trained with) full precision weights.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnSave(const RNN* net_ptr, const wchar_t* file_path, const int weight_precision);
+
+	/// <summary>
+	/// Returns a pointer to a recurrent neural net loaded from the file with the given path (see "RnnSave").
+	///	Returns "null" if fails.
+	/// </summary>
+	__declspec(dllexport) RNN* RnnLoad(const wchar_t* file_path);
+
+	/// <summary>
+	/// Releases the training context and data of the net represented with <paramref name="net_ptr"/>
+	/// turning it into an inference-only one.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnFreeze(RNN* net_ptr);
+
+	/// <summary>
+	/// Returns "true" if the net represented with <paramref name="net_ptr"/> is inference-only (see "RnnFreeze").
+	/// </summary>
+	__declspec(dllexport) bool RnnIsFrozen(const RNN* net_ptr);
+
 	/// <summary>
 	/// Frees the given pointer to a net.
 	///	Returns "true" if succeeded.
 	/// </summary>
 	__declspec(dllexport) bool RnnFree(const RNN* net_ptr);
 
+	/// <summary>
+	/// Returns a pointer to an evaluation stream of the net represented with <paramref name="net_ptr"/>.
+	/// The net must outlive the stream. Returns "null" if fails.
+	/// </summary>
+	__declspec(dllexport) RNNStream* RnnStreamOpen(const RNN* net_ptr);
+
+	/// <summary>
+	/// Pushes the given time-point <paramref name="item"/> into the stream represented with <paramref name="stream_ptr"/>
+	/// and writes the output of the net at the latest time-point into the caller-provided buffer <paramref name="output"/>.
+	/// Returns number of elements written ("0" until the stream accumulates "depth" items) or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int RnnStreamPush(RNNStream* stream_ptr,
+		const int item_size, const double* item, const int output_capacity, double* output);
+
+	/// <summary>
+	/// Discards all the items pushed into the stream represented with <paramref name="stream_ptr"/>.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnStreamReset(RNNStream* stream_ptr);
+
+	/// <summary>
+	/// Frees the given pointer to a stream.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnStreamClose(const RNNStream* stream_ptr);
+
+	/// <summary>
+	/// Returns a pointer to a set of <paramref name="stream_count"/> evaluation streams of the net
+	/// represented with <paramref name="net_ptr"/> which are advanced in lockstep. The net must outlive the streams.
+	///	Returns "null" if fails.
+	/// </summary>
+	__declspec(dllexport) RNNMultiStream* RnnMultiStreamOpen(const RNN* net_ptr, const int stream_count);
+
+	/// <summary>
+	/// Appends a time-point item to each stream of the multi-stream represented with <paramref name="multi_stream_ptr"/>
+	/// (<paramref name="items"/> contains the items of all the streams one after another).
+	///	Returns number of streams with complete windows or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int RnnMultiStreamPushAll(RNNMultiStream* multi_stream_ptr,
+		const int aggregate_size, const double* items);
+
+	/// <summary>
+	/// Writes outputs corresponding to the latest time-point of each stream of the multi-stream represented with
+	/// <paramref name="multi_stream_ptr"/> into <paramref name="output"/> (one after another).
+	///	Returns number of elements written ("0" if the windows are not complete yet) or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int RnnMultiStreamReadAll(const RNNMultiStream* multi_stream_ptr,
+		const int output_capacity, double* output);
+
+	/// <summary>
+	/// Discards all the items pushed into the multi-stream represented with <paramref name="multi_stream_ptr"/>.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnMultiStreamReset(RNNMultiStream* multi_stream_ptr);
+
+	/// <summary>
+	/// Frees the given pointer to a multi-stream.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnMultiStreamClose(const RNNMultiStream* multi_stream_ptr);
+
+	/// <summary>
+	/// Trains <paramref name="candidate_count"/> candidate nets concurrently on the windows of the given series
+	/// (see "RnnFitSeries") and ranks them by the best validation cost (the validation fraction of
+	/// <paramref name="options"/> must be positive). The candidate "i" has depth <paramref name="time_depths"/>[i] and
+	/// <paramref name="layer_counts"/>[i] layer item sizes (including the input one) taken one after another from
+	/// <paramref name="layer_item_sizes"/>; <paramref name="layer_activations"/> contains "RnnActivation" values of the
+	/// layers of all the candidates one after another ("layer_counts[i] - 1" items per candidate, "null" means sigmoid
+	/// for all the layers) and <paramref name="cost"/> is an "RnnCost" value shared by all the candidates.
+	/// <paramref name="thread_count"/> is the number of threads to train the candidates on ("0" means the number of
+	/// hardware threads). Pointers to the trained nets are written into <paramref name="nets"/> in the order of the
+	/// candidates (they must be freed with "RnnFree") and the ranked results into <paramref name="results"/>
+	/// (both arrays must have "candidate_count" items). Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnSweep(const int candidate_count, const int* time_depths, const int* layer_counts,
+		const int* layer_item_sizes, const int* layer_activations, const int cost, const int series_size,
+		const double* input_series, const int ref_series_size, const double* reference_series, const int stride,
+		const FitOptions* options, const int thread_count, RNN** nets, SweepResult* results);
+
+	/// <summary>
+	/// Returns a pointer to an ensemble of the given nets (which must outlive the ensemble) whose outputs are averaged
+	/// with the given <paramref name="weights"/> ("null" means equal weights).
+	///	Returns "null" if fails.
+	/// </summary>
+	__declspec(dllexport) RNNEnsemble* RnnEnsembleConstruct(const int member_count, const RNN* const* members,
+		const double* weights);
+
+	/// <summary>
+	/// Evaluates all the members of the ensemble at the given <paramref name="input"/> (see "RnnEnsembleGetDepth")
+	/// and writes the weighted average of their latest output items into <paramref name="output"/> and (if
+	/// <paramref name="member_outputs"/> is not "null") the latest output items of the members themselves.
+	///	Returns number of elements written into <paramref name="output"/> or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int RnnEnsembleEvaluate(RNNEnsemble* ensemble_ptr, const int size, const double* input,
+		const int output_capacity, double* output, const int member_output_capacity, double* member_outputs);
+
+	/// <summary>
+	/// Returns number of time-point items the input of the ensemble must consist of (the maximal depth of its members).
+	///	Returns "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int RnnEnsembleGetDepth(const RNNEnsemble* ensemble_ptr);
+
+	/// <summary>
+	/// Frees the given pointer to an ensemble.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnEnsembleFree(const RNNEnsemble* ensemble_ptr);
+
+	/// <summary>
+	/// Returns a pointer to a streaming detector of anomalies of the given kind ("AnomalyKind" value)
+	/// in a series of values (see "SeriesAnomalyDetector").
+	///	Returns "null" if fails.
+	/// </summary>
+	__declspec(dllexport) SeriesAnomalyDetector* AnomalyDetectorConstruct(const int kind,
+		const int history_length, const double confidence);
+
+	/// <summary>
+	/// Processes the given next values of the series and writes zero-based indices (within <paramref name="values"/>)
+	/// of the anomalous ones into <paramref name="anomaly_ids"/> (its <paramref name="capacity"/> must be at least
+	/// <paramref name="count"/>, otherwise the detector is left intact).
+	///	Returns number of the written indices or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int AnomalyDetectorPush(SeriesAnomalyDetector* detector_ptr, const int count,
+		const double* values, const int capacity, int* anomaly_ids);
+
+	/// <summary>
+	/// Discards the history of the series of the given detector.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool AnomalyDetectorReset(SeriesAnomalyDetector* detector_ptr);
+
+	/// <summary>
+	/// Frees the given pointer to an anomaly detector.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool AnomalyDetectorFree(const SeriesAnomalyDetector* detector_ptr);
+
+	/// <summary>
+	/// Returns a pointer to an engine computing the given technical indicators of a series of k-lines
+	/// (see "IndicatorEngine").
+	///	Returns "null" if fails.
+	/// </summary>
+	__declspec(dllexport) IndicatorEngine* IndicatorEngineConstruct(const int spec_count, const IndicatorSpec* specs);
+
+	/// <summary>
+	/// Processes the given next k-lines of the series (passed column-wise, <paramref name="kline_count"/>
+	/// elements in each column) and writes values of the indicators into <paramref name="output"/>
+	/// in the time-major order (values of all the indicators per k-line).
+	///	Returns number of elements written or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int IndicatorEngineUpdate(IndicatorEngine* engine_ptr, const int kline_count,
+		const double* high_price, const double* low_price, const double* close_price, const double* volume,
+		const int output_capacity, double* output);
+
+	/// <summary>
+	/// Returns number of k-lines processed by the given engine or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) long long IndicatorEngineGetKLineCount(const IndicatorEngine* engine_ptr);
+
+	/// <summary>
+	/// Discards the state of the indicators of the given engine.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool IndicatorEngineReset(IndicatorEngine* engine_ptr);
+
+	/// <summary>
+	/// Frees the given pointer to an indicator engine.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool IndicatorEngineFree(const IndicatorEngine* engine_ptr);
+
+	/// <summary>
+	/// Aggregates the given chronologically ordered k-lines into k-lines of the given span (in milliseconds)
+	/// aligned to "origin_ms + n * span_ms" time points (see "KLineResampler") and writes them
+	/// (including the last incomplete one) into <paramref name="output"/>.
+	///	Returns number of the written k-lines or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int KLineResample(const int count, const PackedKLine* items,
+		const long long span_ms, const long long origin_ms, const int output_capacity, PackedKLine* output);
+
+	/// <summary>
+	/// Returns a pointer to a streaming resampler of k-lines to the given span
+	/// (in milliseconds) aligned to "origin_ms + n * span_ms" time points (see "KLineResampler").
+	///	Returns "null" if fails.
+	/// </summary>
+	__declspec(dllexport) KLineResampler* KLineResamplerConstruct(const long long span_ms, const long long origin_ms);
+
+	/// <summary>
+	/// Processes the given next k-lines and writes the coarse k-lines completed by them into <paramref name="output"/>.
+	///	Returns number of the written k-lines or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int KLineResamplerPush(KLineResampler* resampler_ptr, const int count,
+		const PackedKLine* items, const int output_capacity, PackedKLine* output);
+
+	/// <summary>
+	/// Writes the still-open coarse k-line of the given resampler into <paramref name="bar"/>.
+	///	Returns "true" if there is an open k-line.
+	/// </summary>
+	__declspec(dllexport) bool KLineResamplerGetOpenBar(const KLineResampler* resampler_ptr, PackedKLine* bar);
+
+	/// <summary>
+	/// Discards the open coarse k-line of the given resampler.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool KLineResamplerReset(KLineResampler* resampler_ptr);
+
+	/// <summary>
+	/// Frees the given pointer to a resampler.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool KLineResamplerFree(const KLineResampler* resampler_ptr);
+
+	/// <summary>
+	/// Writes the given chronologically ordered k-lines split into blocks of the given sizes
+	/// (the blocks follow one another in <paramref name="items"/>) into a columnar archive file (see "KLineArchive").
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool KLineArchiveWrite(const wchar_t* file_path, const int block_count,
+		const int* block_sizes, const PackedKLine* items, const bool compress);
+
+	/// <summary>
+	/// Returns a pointer to an archive of k-lines mapped from the given file.
+	///	Returns "null" if fails.
+	/// </summary>
+	__declspec(dllexport) KLineArchive* KLineArchiveOpen(const wchar_t* file_path);
+
+	/// <summary>
+	/// Returns number of blocks in the given archive or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int KLineArchiveGetBlockCount(const KLineArchive* archive_ptr);
+
+	/// <summary>
+	/// Writes summary of the given block of the archive into <paramref name="info"/>.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool KLineArchiveGetBlockInfo(const KLineArchive* archive_ptr,
+		const int block_id, ArchiveBlockInfo* info);
+
+	/// <summary>
+	/// Writes the given range of k-lines of the given block of the archive (clamped to the size of the block)
+	/// into <paramref name="output"/>.
+	///	Returns number of the written k-lines or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int KLineArchiveRead(const KLineArchive* archive_ptr, const int block_id,
+		const int begin_kline_id, const int count, PackedKLine* output);
+
+	/// <summary>
+	/// Frees the given pointer to an archive (unmaps the file).
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool KLineArchiveFree(const KLineArchive* archive_ptr);
+
+	/// <summary>
+	/// Returns a pointer to an empty order book kept up to date with diff updates (see "OrderBook").
+	///	Returns "null" if fails.
+	/// </summary>
+	__declspec(dllexport) OrderBook* OrderBookConstruct();
+
+	/// <summary>
+	/// Replaces content of the given order book with the given snapshot.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool OrderBookApplySnapshot(OrderBook* book_ptr, const long long update_id,
+		const int bid_count, const double* bid_prices, const double* bid_quantities,
+		const int ask_count, const double* ask_prices, const double* ask_quantities);
+
+	/// <summary>
+	/// Merges the given diff covering updates from <paramref name="first_update_id"/> to <paramref name="last_update_id"/>
+	/// into the given order book (a zero quantity removes the price level).
+	///	Returns "OrderBookDiffResult" value or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int OrderBookApplyDiff(OrderBook* book_ptr,
+		const long long first_update_id, const long long last_update_id,
+		const int bid_count, const double* bid_prices, const double* bid_quantities,
+		const int ask_count, const double* ask_prices, const double* ask_quantities);
+
+	/// <summary>
+	/// Returns identifier of the last update reflected by the given order book
+	/// or "-1" if no snapshot was applied yet or in case of failure.
+	/// </summary>
+	__declspec(dllexport) long long OrderBookGetUpdateId(const OrderBook* book_ptr);
+
+	/// <summary>
+	/// Returns number of price levels on the given side ("OrderBookSide" value) of the given order book
+	/// or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int OrderBookGetLevelCount(const OrderBook* book_ptr, const int side);
+
+	/// <summary>
+	/// Writes the best levels of the given side ("OrderBookSide" value) of the given order book into
+	/// <paramref name="prices"/> and <paramref name="quantities"/> and, unless <paramref name="cumulative"/>
+	/// is "null", running totals of the quantities into <paramref name="cumulative"/>.
+	///	Returns number of the written levels or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int OrderBookGetDepth(const OrderBook* book_ptr, const int side, const int capacity,
+		double* prices, double* quantities, double* cumulative);
+
+	/// <summary>
+	/// Writes the best price buckets of the given size of the given side ("OrderBookSide" value) of the given
+	/// order book into <paramref name="prices"/> and <paramref name="quantities"/> and, unless
+	/// <paramref name="cumulative"/> is "null", running totals of the quantities into <paramref name="cumulative"/>.
+	///	Returns number of the written buckets or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int OrderBookAggregate(OrderBook* book_ptr, const int side, const double bucket_size,
+		const int capacity, double* prices, double* quantities, double* cumulative);
+
+	/// <summary>
+	/// Frees the given pointer to an order book.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool OrderBookFree(const OrderBook* book_ptr);
+
+	/// <summary>
+	/// The same as "RnnEvaluateKLines" but takes the k-lines directly from the given block of the archive.
+	///	Returns number of elements written or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int RnnEvaluateArchiveBlock(const RNN* net_ptr, const KLineArchive* archive_ptr,
+		const int block_id, const int normalization_window, const int output_capacity, double* output);
+
+	/// <summary>
+	/// Returns number of features the native feature-engineering stage computes per k-line
+	/// (i.e., the input item size of a net that can be fed with k-lines).
+	/// </summary>
+	__declspec(dllexport) int KLineFeatureCount();
+
+	/// <summary>
+	/// Evaluates the net represented with <paramref name="net_ptr"/> at each sliding window of the features of
+	/// the given k-lines (passed column-wise, <paramref name="kline_count"/> elements in each column)
+	/// and writes the concatenated results into <paramref name="output"/>.
+	///	Returns number of elements written or "-1" in case of failure.
+	/// </summary>
+	__declspec(dllexport) int RnnEvaluateKLines(const RNN* net_ptr, const int kline_count,
+		const double* open_price, const double* high_price, const double* low_price, const double* close_price,
+		const double* volume, const int* trade_count, const int normalization_window,
+		const int output_capacity, double* output);
+
+	/// <summary>
+	/// Performs a training iteration of the net represented with <paramref name="net_ptr"/> on all the sliding windows
+	/// of the features of the given k-lines (passed column-wise, <paramref name="kline_count"/> elements in each column).
+	/// The reference of each time-point is "1" if the next k-line closes higher and "0" otherwise.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnTrainKLines(RNN* net_ptr, const int kline_count,
+		const double* open_price, const double* high_price, const double* low_price, const double* close_price,
+		const double* volume, const int* trade_count, const int normalization_window, const double learning_rate);
+
+	/// <summary>
+	/// Writes snapshot of the hot-path counters of the net represented with <paramref name="net_ptr"/>
+	/// into <paramref name="stats"/> (see "IsInstrumentationEnabled").
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnGetStats(const RNN* net_ptr, RnnStats* stats);
+
+	/// <summary>
+	/// Sets all the hot-path counters of the net represented with <paramref name="net_ptr"/> to zero.
+	///	Returns "true" if succeeded.
+	/// </summary>
+	__declspec(dllexport) bool RnnResetStats(const RNN* net_ptr);
+
+	/// <summary>
+	/// Returns "true" if the DLL is compiled with the hot-path instrumentation on
+	/// (otherwise all the counters remain zero).
+	/// </summary>
+	__declspec(dllexport) bool IsInstrumentationEnabled();
+
 	/// <summary>
 	/// Returns "true" if the DLL is compiled against "single" precision arithmetics.
 	/// </summary>